@@ -0,0 +1,81 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include "list.h"
+
+namespace blk
+{
+// Blocking multi-producer multi-consumer queue over a blk::list guarded by
+// one mutex. Nodes are built before the lock is taken and moved in with an
+// O(1) splice, and consumers can take every pending element with one lock
+// acquisition through drain(). A capacity of 0 makes the channel unbounded;
+// otherwise producers wait while it is full. Once closed, pushes fail and
+// consumers receive what is left and then stop waiting. Batches are spliced
+// in O(1) when their allocator equals the channel's one and moved element by
+// element otherwise, as in list::splice
+template<class T, class Allocator = std::allocator<T>>
+class channel
+{
+public:
+	using value_type = T;
+	using allocator_type = Allocator;
+	using list_type = list<T, Allocator>;
+	using size_type = size_t;
+
+	explicit channel(size_type capacity = 0, const Allocator& alloc = Allocator());
+	channel(const channel&) = delete;
+	channel& operator=(const channel&) = delete;
+
+	allocator_type get_allocator() const;
+	size_type capacity() const noexcept;
+	size_type size() const;
+	bool empty() const;
+
+	// Stops accepting elements and wakes every waiting thread
+	void close();
+	bool closed() const;
+
+	// Producers; return false, leaving the argument untouched, when the
+	// channel is closed (or full, for the try_ versions)
+	bool push(const value_type& value);
+	bool push(value_type&& value);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	bool try_push(const value_type& value);
+	bool try_push(value_type&& value);
+	// Appends the whole batch, leaving it empty. A bounded channel waits for
+	// room for all of it, or until it is empty when the batch alone exceeds
+	// the capacity
+	bool push_all(list_type& batch);
+	bool push_all(list_type&& batch);
+
+	// Consumers; pop waits for an element and returns false once the channel
+	// is closed and empty
+	bool pop(value_type& value);
+	bool try_pop(value_type& value);
+	// Appends every pending element to out in O(1) and returns their number;
+	// drain waits until something is pending and returns 0 once the channel
+	// is closed and empty
+	size_type drain(list_type& out);
+	size_type try_drain(list_type& out);
+
+private:
+	bool hasRoom(size_type count) const;
+	bool pushNodes(list_type& nodes, bool wait);
+	size_type takeAll(list_type& out);
+	void notifyRoom();
+
+	allocator_type m_alloc;
+	size_type m_capacity;
+	bool m_closed;
+	list_type m_items;
+	mutable std::mutex m_mutex;
+	std::condition_variable m_notEmpty;
+	std::condition_variable m_notFull;
+};
+
+}
+
+#include "../src/channel.cpp"
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+#include "list.h"
+
+// Size in bytes of a deque block; blocks hold at least 16 elements
+#ifndef BLK_DEQUE_BLOCK_BYTES
+#define BLK_DEQUE_BLOCK_BYTES 512
+#endif
+
+namespace blk
+{
+template<class T>
+struct DequeBlock
+{
+	static const size_t size = sizeof(T) * 16 < BLK_DEQUE_BLOCK_BYTES ? BLK_DEQUE_BLOCK_BYTES / sizeof(T) : 16;
+};
+
+// Position in a deque's block map; stays valid while the map is not
+// reallocated, which only pushes and inserts can do
+template<class T, bool IsConst = false>
+class DequeIterator
+{
+public:
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = T;
+	using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+	using reference = typename std::conditional<IsConst, const T&, T&>::type;
+	using difference_type = std::ptrdiff_t;
+
+	DequeIterator();
+	DequeIterator(const DequeIterator<value_type, false>& it);
+	DequeIterator(T* const* map, size_t index);
+
+	template<bool B>
+	bool operator==(const DequeIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator!=(const DequeIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator<(const DequeIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator<=(const DequeIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator>(const DequeIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator>=(const DequeIterator<value_type, B>& it) const;
+	template<bool B>
+	difference_type operator-(const DequeIterator<value_type, B>& it) const;
+
+	DequeIterator& operator++();
+	DequeIterator& operator--();
+	DequeIterator operator++(int);
+	DequeIterator operator--(int);
+	DequeIterator& operator+=(difference_type n);
+	DequeIterator& operator-=(difference_type n);
+	DequeIterator operator+(difference_type n) const;
+	DequeIterator operator-(difference_type n) const;
+
+	reference operator*() const;
+	pointer operator->() const;
+	reference operator[](difference_type n) const;
+
+	T* const* getMap() const;
+	size_t getIndex() const;
+
+private:
+	T* const* m_map;
+	size_t m_index;
+};
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst> operator+(typename DequeIterator<T, IsConst>::difference_type n, const DequeIterator<T, IsConst>& it);
+
+// Double-ended queue storing its elements in fixed size blocks reached
+// through a map of block pointers: pushing and popping at either end is O(1)
+// and allocates one block per DequeBlock<T>::size elements instead of a node
+// per element. One emptied block is kept for reuse, so a FIFO queue of
+// steady length stops allocating. Allocators are handled like in blk::list,
+// with copy and move assignment following the propagation traits
+template<class T, class Allocator = std::allocator<T>>
+class deque
+{
+public:
+	using value_type = T;
+	using allocator_type = Allocator;
+	using iterator = DequeIterator<value_type>;
+	using const_iterator = DequeIterator<value_type, true>;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	using size_type = size_t;
+	using reference = value_type & ;
+	using const_reference = const value_type&;
+	using pointer = typename std::allocator_traits<Allocator>::pointer;
+	using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+	using difference_type = std::ptrdiff_t;
+
+	static const size_type block_size = DequeBlock<T>::size;
+
+	// Constructors and destructor
+	deque();
+	explicit deque(const Allocator& alloc);
+	explicit deque(size_type count, const value_type& value, const Allocator& alloc = Allocator());
+	explicit deque(size_type count, const Allocator& alloc = Allocator());
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	deque(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+	deque(const deque& other);
+	deque(const deque& other, const Allocator& alloc);
+	deque(deque&& other) noexcept;
+	deque(deque&& other, const Allocator& alloc);
+	deque(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+	~deque();
+
+	// Assignments and allocator getter
+	deque& operator=(const deque& other);
+	deque& operator=(deque&& other);
+	deque& operator=(std::initializer_list<T> init);
+	void assign(size_type count, const T& value);
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	void assign(InputIt first, InputIt last);
+	void assign(std::initializer_list<T> init);
+	allocator_type get_allocator() const;
+
+	// Element access
+	reference at(size_type pos);
+	const_reference at(size_type pos) const;
+	reference operator[](size_type pos);
+	const_reference operator[](size_type pos) const;
+	reference front();
+	const_reference front() const;
+	reference back();
+	const_reference back() const;
+
+	// Iterators
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator cbegin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+	const_iterator cend() const noexcept;
+	reverse_iterator rbegin() noexcept;
+	const_reverse_iterator rbegin() const noexcept;
+	const_reverse_iterator crbegin() const noexcept;
+	reverse_iterator rend() noexcept;
+	const_reverse_iterator rend() const noexcept;
+	const_reverse_iterator crend() const noexcept;
+
+	// Capacity
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	size_type max_size() const noexcept;
+	// Frees the spare block and the map when the deque is empty
+	void shrink_to_fit();
+
+	// Modifiers
+	void clear() noexcept;
+	// Middle insertions and erasures move the elements on the shorter side
+	iterator insert(const_iterator pos, const value_type& value);
+	iterator insert(const_iterator pos, value_type&& value);
+	template<class... Args>
+	iterator emplace(const_iterator pos, Args&&... args);
+	iterator erase(const_iterator pos);
+	iterator erase(const_iterator first, const_iterator last);
+	void push_back(const value_type& value);
+	void push_back(value_type&& value);
+	template<class... Args>
+	reference emplace_back(Args&&... args);
+	void push_front(const value_type& value);
+	void push_front(value_type&& value);
+	template<class... Args>
+	reference emplace_front(Args&&... args);
+	void pop_back();
+	void pop_front();
+	void resize(size_type count);
+	void resize(size_type count, const value_type& value);
+	void swap(deque& other);
+
+private:
+	using block_pointer = T*;
+	using map_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<block_pointer>;
+
+	T* slot(size_type index) const;
+	T* acquireBlock();
+	void releaseBlock(size_type block) noexcept;
+	void reserveMap();
+	void destroyAll() noexcept;
+	void deallocateStorage() noexcept;
+	void steal(deque& other) noexcept;
+
+	allocator_type m_alloc;
+	block_pointer *m_map;
+	size_type m_mapSize;
+	size_type m_start;
+	size_type m_size;
+	block_pointer m_spare;
+};
+
+template<class T, class Alloc>
+bool operator==(const deque<T, Alloc>& left, const deque<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator!=(const deque<T, Alloc>& left, const deque<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator<(const deque<T, Alloc>& left, const deque<T, Alloc>& right);
+
+}
+
+namespace std
+{
+	template<class T, class Alloc>
+	void swap(blk::deque<T, Alloc>& left, blk::deque<T, Alloc>& right);
+}
+
+#include "../src/deque.cpp"
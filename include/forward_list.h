@@ -0,0 +1,184 @@
+#pragma once
+
+#include "list.h"
+
+namespace blk
+{
+template<class T>
+struct ForwardListNode
+{
+	T val;
+	ForwardListNode<T> *next;
+};
+
+template<class T, bool IsConst = false>
+class ForwardListIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = T;
+	using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+	using reference = typename std::conditional<IsConst, const T&, T&>::type;
+	using difference_type = std::ptrdiff_t;
+
+	ForwardListIterator();
+	ForwardListIterator(const ForwardListIterator<value_type, false>& it);
+	explicit ForwardListIterator(ForwardListNode<value_type>* node);
+
+	template<bool B>
+	bool operator==(const ForwardListIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator!=(const ForwardListIterator<value_type, B>& it) const;
+
+	ForwardListIterator& operator++();
+	ForwardListIterator operator++(int);
+
+	reference operator*() const;
+	pointer operator->() const;
+
+	ForwardListNode<value_type> * getNode() const;
+
+private:
+	ForwardListNode<T> *m_item;
+};
+
+// Singly linked list with the std::forward_list interface; the head node
+// plays the role of before_begin() and the chain ends with nullptr
+template<class T, class Allocator = std::allocator<T>>
+class forward_list
+{
+public:
+	using value_type = T;
+	using allocator_type = Allocator;
+	using iterator = ForwardListIterator<value_type>;
+	using const_iterator = ForwardListIterator<value_type, true>;
+	using size_type = size_t;
+	using reference = value_type & ;
+	using const_reference = const value_type&;
+	using pointer = typename std::allocator_traits<Allocator>::pointer;
+	using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+	using difference_type = std::ptrdiff_t;
+
+	// Constructors and destructor
+	forward_list();
+	explicit forward_list(const Allocator& alloc);
+	explicit forward_list(size_type count, const value_type& value, const Allocator& alloc = Allocator());
+	explicit forward_list(size_type count, const Allocator& alloc = Allocator());
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	forward_list(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+	forward_list(const forward_list& other);
+	forward_list(const forward_list& other, const Allocator& alloc);
+	forward_list(forward_list&& other);
+	forward_list(forward_list&& other, const Allocator& alloc);
+	forward_list(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+	~forward_list();
+
+	// Assignments and allocator getter
+	forward_list& operator=(const forward_list& other);
+	forward_list& operator=(forward_list&& other);
+	forward_list& operator=(std::initializer_list<T> init);
+	void assign(size_type count, const T& value);
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	void assign(InputIt first, InputIt last);
+	void assign(std::initializer_list<T> init);
+	allocator_type get_allocator() const;
+
+	// Element access
+	reference front();
+	const_reference front() const;
+
+	// Iterators
+	iterator before_begin() noexcept;
+	const_iterator before_begin() const noexcept;
+	const_iterator cbefore_begin() const noexcept;
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator cbegin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+	const_iterator cend() const noexcept;
+
+	// Capacity
+	bool empty() const noexcept;
+	size_type max_size() const noexcept;
+
+	// Modifiers
+	void clear() noexcept;
+	iterator insert_after(const_iterator pos, const value_type& value);
+	iterator insert_after(const_iterator pos, value_type&& value);
+	iterator insert_after(const_iterator pos, size_type count, const value_type& value);
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	iterator insert_after(const_iterator pos, InputIt first, InputIt last);
+	iterator insert_after(const_iterator pos, std::initializer_list<T> init);
+	template<class... Args>
+	iterator emplace_after(const_iterator pos, Args&&... args);
+	iterator erase_after(const_iterator pos);
+	iterator erase_after(const_iterator first, const_iterator last);
+	void push_front(const value_type& value);
+	void push_front(value_type&& value);
+	template<class... Args>
+	reference emplace_front(Args&&... args);
+	void pop_front();
+	void resize(size_type count);
+	void resize(size_type count, const value_type& value);
+	void swap(forward_list& other);
+
+	// Operations
+	void merge(forward_list& other);
+	void merge(forward_list&& other);
+	template <class Compare>
+	void merge(forward_list& other, Compare comp);
+	template <class Compare>
+	void merge(forward_list&& other, Compare comp);
+	void splice_after(const_iterator pos, forward_list& other);
+	void splice_after(const_iterator pos, forward_list&& other);
+	void splice_after(const_iterator pos, forward_list& other, const_iterator it);
+	void splice_after(const_iterator pos, forward_list&& other, const_iterator it);
+	void splice_after(const_iterator pos, forward_list& other, const_iterator first, const_iterator last);
+	void splice_after(const_iterator pos, forward_list&& other, const_iterator first, const_iterator last);
+	void remove(const value_type& value);
+	template<class UnaryPredicate>
+	void remove_if(UnaryPredicate p);
+	void reverse() noexcept;
+	void unique();
+	template<class BinaryPredicate>
+	void unique(BinaryPredicate p);
+	void sort();
+	template<class Compare>
+	void sort(Compare comp);
+
+private:
+	using node_type = ForwardListNode<T>;
+	using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+
+	node_type* allocateNode(node_type* next);
+	node_type* allocateHeadNode();
+	node_type* destroyNode(node_type* node);
+	void commonSplice(const_iterator pos, forward_list& other, const_iterator first, const_iterator last);
+
+	allocator_type m_alloc;
+	node_type* m_headNode;
+};
+
+template<class T, class Alloc>
+bool operator==(const forward_list<T, Alloc>& left, const forward_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator!=(const forward_list<T, Alloc>& left, const forward_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator<(const forward_list<T, Alloc>& left, const forward_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator<=(const forward_list<T, Alloc>& left, const forward_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator>(const forward_list<T, Alloc>& left, const forward_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator>=(const forward_list<T, Alloc>& left, const forward_list<T, Alloc>& right);
+
+}
+
+namespace std
+{
+	template<class T, class Alloc>
+	void swap(blk::forward_list<T, Alloc>& left, blk::forward_list<T, Alloc>& right);
+}
+
+#include "../src/forward_list.cpp"
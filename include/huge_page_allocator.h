@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+#if defined(_WIN32)
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace blk
+{
+// Regions of 2 MiB aligned memory, advised to the kernel as transparent huge
+// pages, carved into slots with one free list per slot size. When the advice
+// is refused (or on platforms without it) the regions simply stay on small
+// pages. Not thread-safe: like the containers using it, an arena must not be
+// used from several threads at once
+class HugePageArena
+{
+public:
+	static const size_t hugePageSize = size_t(2) << 20;
+	// Larger requests are forwarded to operator new, or to an aligned
+	// allocation when they need more than fundamental alignment
+	static const size_t maxSlotSize = 1024;
+
+	// regionSize is rounded up to a multiple of hugePageSize
+	explicit HugePageArena(size_t regionSize = hugePageSize);
+	HugePageArena(const HugePageArena&) = delete;
+	HugePageArena& operator=(const HugePageArena&) = delete;
+	~HugePageArena();
+
+	void* allocate(size_t size, size_t align);
+	void deallocate(void* ptr, size_t size, size_t align) noexcept;
+
+	bool owns(const void* ptr) const noexcept;
+	size_t regionSize() const noexcept;
+	size_t regionCount() const noexcept;
+	// Number of regions the huge page advice was accepted for
+	size_t hugePageRegions() const noexcept;
+
+private:
+	struct FreeList
+	{
+		size_t size;
+		size_t align;
+		void *head;
+	};
+
+	static bool isSlotRequest(size_t size, size_t align) noexcept;
+	static void* allocateLarge(size_t size, size_t align);
+	static void deallocateLarge(void* ptr, size_t align) noexcept;
+	static size_t slotAlign(size_t align) noexcept;
+	static size_t slotSize(size_t size, size_t align) noexcept;
+
+	FreeList& freeList(size_t size, size_t align);
+	void reserveRegion();
+
+	std::vector<char*> m_regions;
+	std::vector<FreeList> m_freeLists;
+	char *m_cursor;
+	char *m_end;
+	size_t m_regionSize;
+	size_t m_hugePageRegions;
+};
+
+// Allocator drawing list nodes from a shared HugePageArena, so long lists
+// occupy a few huge pages instead of scattering over 4 KiB pages and
+// traversals take far fewer dTLB misses. A default constructed allocator
+// creates its own arena; copies and rebound copies share it and compare equal
+template<class T>
+class huge_page_allocator
+{
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	huge_page_allocator();
+	explicit huge_page_allocator(std::shared_ptr<HugePageArena> arena);
+	template<class U>
+	huge_page_allocator(const huge_page_allocator<U>& other);
+
+	T* allocate(size_t cnt);
+	void deallocate(T* ptr, size_t cnt) noexcept;
+
+	const std::shared_ptr<HugePageArena>& arena() const noexcept;
+
+private:
+	std::shared_ptr<HugePageArena> m_arena;
+};
+
+template<class T, class U>
+bool operator==(const huge_page_allocator<T>& left, const huge_page_allocator<U>& right);
+template<class T, class U>
+bool operator!=(const huge_page_allocator<T>& left, const huge_page_allocator<U>& right);
+
+}
+
+#include "../src/huge_page_allocator.cpp"
@@ -0,0 +1,256 @@
+#pragma once
+
+#include "list.h"
+
+namespace blk
+{
+// Node threaded into the sequence (next/prev) and into an implicit treap
+// keyed by position, whose subtree counts give O(log n) positional access
+template<class T>
+struct IndexedListNode
+{
+	T val;
+	IndexedListNode<T> *next;
+	IndexedListNode<T> *prev;
+	IndexedListNode<T> *parent;
+	IndexedListNode<T> *left;
+	IndexedListNode<T> *right;
+	size_t count;
+	unsigned priority;
+};
+
+// Treap primitives; the head node is the only node without a parent and
+// keeps the root in its left link
+template<class T>
+struct IndexedListTree
+{
+	using node_type = IndexedListNode<T>;
+
+	static size_t count(const node_type* node);
+	static void update(node_type* node);
+	static void setRoot(node_type* head, node_type* root);
+	static node_type* headOf(node_type* node);
+	static size_t indexOf(const node_type* node);
+	static node_type* nth(node_type* head, size_t index);
+	static void split(node_type* node, size_t index, node_type*& left, node_type*& right);
+	static node_type* merge(node_type* left, node_type* right);
+	static void erase(node_type* node);
+	static void rebuild(node_type* head);
+
+private:
+	static size_t recount(node_type* node);
+};
+
+template<class T, bool IsConst = false>
+class IndexedListIterator
+{
+public:
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = T;
+	using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+	using reference = typename std::conditional<IsConst, const T&, T&>::type;
+	using difference_type = std::ptrdiff_t;
+
+	IndexedListIterator();
+	IndexedListIterator(const IndexedListIterator<value_type, false>& it);
+	explicit IndexedListIterator(IndexedListNode<value_type>* node);
+
+	template<bool B>
+	bool operator==(const IndexedListIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator!=(const IndexedListIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator<(const IndexedListIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator>(const IndexedListIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator<=(const IndexedListIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator>=(const IndexedListIterator<value_type, B>& it) const;
+
+	IndexedListIterator& operator++();
+	IndexedListIterator& operator--();
+	IndexedListIterator operator++(int);
+	IndexedListIterator operator--(int);
+	IndexedListIterator& operator+=(difference_type n);
+	IndexedListIterator& operator-=(difference_type n);
+	IndexedListIterator operator+(difference_type n) const;
+	IndexedListIterator operator-(difference_type n) const;
+	template<bool B>
+	difference_type operator-(const IndexedListIterator<value_type, B>& it) const;
+
+	reference operator*() const;
+	pointer operator->() const;
+	reference operator[](difference_type n) const;
+
+	IndexedListNode<value_type> * getNode() const;
+
+private:
+	IndexedListNode<T> *m_item;
+};
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst> operator+(typename IndexedListIterator<T, IsConst>::difference_type n, const IndexedListIterator<T, IsConst>& it);
+
+// List with the interface of blk::list plus O(log n) nth(k) and index_of(it);
+// its iterators are random access with O(log n) jumps
+template<class T, class Allocator = std::allocator<T>>
+class indexed_list
+{
+public:
+	using value_type = T;
+	using allocator_type = Allocator;
+	using iterator = IndexedListIterator<value_type>;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_iterator = IndexedListIterator<value_type, true>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	using size_type = size_t;
+	using reference = value_type & ;
+	using const_reference = const value_type&;
+	using pointer = typename std::allocator_traits<Allocator>::pointer;
+	using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+	using difference_type = std::ptrdiff_t;
+
+	// Constructors and destructor
+	indexed_list();
+	explicit indexed_list(const Allocator& alloc);
+	explicit indexed_list(size_type count, const value_type& value, const Allocator& alloc = Allocator());
+	explicit indexed_list(size_type count, const Allocator& alloc = Allocator());
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	indexed_list(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+	indexed_list(const indexed_list& other);
+	indexed_list(const indexed_list& other, const Allocator& alloc);
+	indexed_list(indexed_list&& other);
+	indexed_list(indexed_list&& other, const Allocator& alloc);
+	indexed_list(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+	~indexed_list();
+
+	// Assignments and allocator getter
+	indexed_list& operator=(const indexed_list& other);
+	indexed_list& operator=(indexed_list&& other);
+	indexed_list& operator=(std::initializer_list<T> init);
+	void assign(size_type count, const T& value);
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	void assign(InputIt first, InputIt last);
+	void assign(std::initializer_list<T> init);
+	allocator_type get_allocator() const;
+
+	// Element access
+	reference front();
+	const_reference front() const;
+	reference back();
+	const_reference back() const;
+	iterator nth(size_type index);
+	const_iterator nth(size_type index) const;
+	size_type index_of(const_iterator pos) const;
+
+	// Iterators
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator cbegin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+	const_iterator cend() const noexcept;
+	reverse_iterator rbegin() noexcept;
+	const_reverse_iterator rbegin() const noexcept;
+	const_reverse_iterator crbegin() const noexcept;
+	reverse_iterator rend() noexcept;
+	const_reverse_iterator rend() const noexcept;
+	const_reverse_iterator crend() const noexcept;
+
+	// Capacity
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	size_type max_size() const noexcept;
+
+	// Modifiers
+	void clear() noexcept;
+	iterator insert(const_iterator pos, const value_type& value);
+	iterator insert(const_iterator pos, value_type&& value);
+	iterator insert(const_iterator pos, size_type count, const value_type& value);
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	iterator insert(const_iterator pos, InputIt first, InputIt last);
+	iterator insert(const_iterator pos, std::initializer_list<T> init);
+	template<class... Args>
+	iterator emplace(const_iterator pos, Args&&... args);
+	iterator erase(const_iterator pos);
+	iterator erase(const_iterator first, const_iterator last);
+	void push_front(const value_type& value);
+	void push_front(value_type&& value);
+	void push_back(const value_type& value);
+	void push_back(value_type&& value);
+	template<class... Args>
+	reference emplace_back(Args&&... args);
+	template<class... Args>
+	reference emplace_front(Args&&... args);
+	void pop_back();
+	void pop_front();
+	void resize(size_type count);
+	void resize(size_type count, const value_type& value);
+	void swap(indexed_list& other);
+
+	// Operations
+	void merge(indexed_list& other);
+	void merge(indexed_list&& other);
+	template <class Compare>
+	void merge(indexed_list& other, Compare comp);
+	template <class Compare>
+	void merge(indexed_list&& other, Compare comp);
+	void splice(const_iterator pos, indexed_list& other);
+	void splice(const_iterator pos, indexed_list&& other);
+	void splice(const_iterator pos, indexed_list& other, const_iterator it);
+	void splice(const_iterator pos, indexed_list&& other, const_iterator it);
+	void splice(const_iterator pos, indexed_list& other, const_iterator first, const_iterator last);
+	void splice(const_iterator pos, indexed_list&& other, const_iterator first, const_iterator last);
+	void remove(const value_type& value);
+	template<class UnaryPredicate>
+	void remove_if(UnaryPredicate p);
+	void reverse() noexcept;
+	void unique();
+	template<class BinaryPredicate>
+	void unique(BinaryPredicate p);
+	void sort();
+	template<class Compare>
+	void sort(Compare comp);
+
+private:
+	using node_type = IndexedListNode<T>;
+	using tree = IndexedListTree<T>;
+	using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+
+	node_type* allocateNode();
+	node_type* allocateHeadNode();
+	void linkNode(node_type* node, node_type* pos);
+	node_type* destroyNode(node_type* node);
+	void relink(node_type* first);
+	void commonSplice(const_iterator pos, indexed_list& other, const_iterator first, const_iterator last);
+	unsigned nextPriority();
+
+	allocator_type m_alloc;
+	node_type* m_headNode;
+	size_type m_size;
+	unsigned m_seed;
+};
+
+template<class T, class Alloc>
+bool operator==(const indexed_list<T, Alloc>& left, const indexed_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator!=(const indexed_list<T, Alloc>& left, const indexed_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator<(const indexed_list<T, Alloc>& left, const indexed_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator<=(const indexed_list<T, Alloc>& left, const indexed_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator>(const indexed_list<T, Alloc>& left, const indexed_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator>=(const indexed_list<T, Alloc>& left, const indexed_list<T, Alloc>& right);
+
+}
+
+namespace std
+{
+	template<class T, class Alloc>
+	void swap(blk::indexed_list<T, Alloc>& left, blk::indexed_list<T, Alloc>& right);
+}
+
+#include "../src/indexed_list.cpp"
@@ -1,9 +1,21 @@
 #pragma once
 
 #include <memory>
+#include <algorithm>
+#include <vector>
+#include <type_traits>
 #include <limits>
 #include <initializer_list>
 #include <functional>
+#include <unordered_set>
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+// Number of nodes the internal traversals run ahead of the current one
+#ifndef BLK_LIST_PREFETCH_DISTANCE
+#define BLK_LIST_PREFETCH_DISTANCE 4
+#endif
 
 namespace blk
 {
@@ -19,6 +31,42 @@ struct ListNode
 	ListNode<T> *prev;
 };
 
+template<class Node>
+void prefetchNode(const Node* node);
+
+// Stable merge sort of `size` nodes chained through `next` and terminated by
+// nullptr; returns the new first node
+template<class Node, class Compare>
+Node* sortChain(Node* first, size_t size, Compare comp);
+template<class Node, class Compare>
+Node* mergeChains(Node* left, Node* right, Compare comp);
+
+// Stable sort of a chain by a key computed once per node; integral keys are
+// ordered with an LSD radix sort, any other key with operator<
+template<class Key, class Node>
+struct ListSortRecord
+{
+	Key key;
+	Node *node;
+};
+
+template<class Node, class KeyFn>
+Node* sortChainByKey(Node* first, size_t size, KeyFn key);
+
+// Walks `distance` nodes ahead of a traversal and prefetches them
+template<class Node>
+class ListPrefetcher
+{
+public:
+	ListPrefetcher(const Node* first, const Node* last, size_t distance = BLK_LIST_PREFETCH_DISTANCE);
+
+	void advance();
+
+private:
+	const Node *m_ahead;
+	const Node *m_last;
+};
+
 template<class T, bool IsConst = false>
 class ListIterator
 {
@@ -68,6 +116,123 @@ private:
 	ListNode<T> *m_item;
 };
 
+// Reverse iterator that walks prev links directly instead of wrapping
+// ListIterator the way std::reverse_iterator does; base() still follows the
+// std::reverse_iterator convention
+template<class T, bool IsConst = false>
+class ListReverseIterator
+{
+public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = T;
+	using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+	using reference = typename std::conditional<IsConst, const T&, T&>::type;
+	using difference_type = std::ptrdiff_t;
+
+	ListReverseIterator();
+	ListReverseIterator(const ListReverseIterator<value_type, false>& it);
+	explicit ListReverseIterator(ListNode<value_type>* node);
+	explicit ListReverseIterator(const ListIterator<value_type, IsConst>& base);
+
+	template<bool B>
+	bool operator==(const ListReverseIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator!=(const ListReverseIterator<value_type, B>& it) const;
+
+	ListReverseIterator& operator++();
+	ListReverseIterator& operator--();
+	ListReverseIterator operator++(int);
+	ListReverseIterator operator--(int);
+
+	reference operator*() const;
+	pointer operator->() const;
+
+	ListIterator<value_type, IsConst> base() const;
+	ListNode<value_type> * getNode() const;
+
+private:
+	ListNode<T> *m_item;
+};
+
+// Range over a list from back to front; holds only a reference to the list
+template<class List>
+class ListReversedView
+{
+public:
+	using iterator = decltype(std::declval<List&>().rbegin());
+	using reference = decltype(*std::declval<iterator>());
+	using size_type = typename List::size_type;
+
+	explicit ListReversedView(List& list) noexcept;
+
+	iterator begin() const noexcept;
+	iterator end() const noexcept;
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	reference front() const;
+	reference back() const;
+
+private:
+	List *m_list;
+};
+
+// Decides whether a node owned by one allocator can be relinked into a list
+// using another one; when it cannot, splice moves the value into a new node
+template<class Allocator>
+struct ListNodeTransfer
+{
+	static bool canRelinkAll(const Allocator& to, const Allocator& from);
+	static bool canRelink(const Allocator& to, const Allocator& from, const void* node);
+};
+
+// Hash and equality over pointers to elements, used to index the values of
+// a list in place without copying them
+template<class T, class Hash>
+struct ListValueHash
+{
+	size_t operator()(const T* value) const;
+	Hash hash;
+};
+
+template<class T, class KeyEqual>
+struct ListValueEqual
+{
+	bool operator()(const T* left, const T* right) const;
+	KeyEqual equal;
+};
+
+// Owns a single node extracted from a list together with a copy of the
+// allocator that has to free it
+template<class T, class Allocator>
+class ListNodeHandle
+{
+public:
+	using value_type = T;
+	using allocator_type = Allocator;
+
+	ListNodeHandle() noexcept;
+	ListNodeHandle(ListNode<T>* node, const Allocator& alloc);
+	ListNodeHandle(ListNodeHandle&& other) noexcept;
+	ListNodeHandle& operator=(ListNodeHandle&& other);
+	~ListNodeHandle();
+
+	bool empty() const noexcept;
+	explicit operator bool() const noexcept;
+	allocator_type get_allocator() const;
+	value_type& value() const;
+	void swap(ListNodeHandle& other) noexcept;
+
+	// Gives up ownership of the node without destroying it
+	ListNode<T> * release() noexcept;
+	ListNode<T> * getNode() const noexcept;
+
+private:
+	void reset();
+
+	ListNode<T> *m_node;
+	Allocator m_alloc;
+};
+
 template<class T, class Allocator = std::allocator<T>>
 class list
 {
@@ -75,15 +240,16 @@ public:
 	using value_type = T;
 	using allocator_type = Allocator;
 	using iterator = ListIterator<value_type>;
-	using reverse_iterator = std::reverse_iterator<iterator>;
+	using reverse_iterator = ListReverseIterator<value_type>;
 	using const_iterator = ListIterator<value_type, true>;
-	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	using const_reverse_iterator = ListReverseIterator<value_type, true>;
 	using size_type = size_t;
 	using reference = value_type & ;
 	using const_reference = const value_type&;
 	using pointer = typename std::allocator_traits<Allocator>::pointer;
 	using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
 	using difference_type = std::ptrdiff_t;
+	using node_type = ListNodeHandle<T, Allocator>;
 
 	// Constructors and destructor
 	list();
@@ -128,6 +294,8 @@ public:
 	reverse_iterator rend() noexcept;
 	const_reverse_iterator rend() const noexcept;
 	const_reverse_iterator crend() const noexcept;
+	ListReversedView<list> reversed() noexcept;
+	ListReversedView<const list> reversed() const noexcept;
 
 	// Capacity
 	bool empty() const noexcept;
@@ -142,8 +310,10 @@ public:
 	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
 	iterator insert(const_iterator pos, InputIt first, InputIt last);
 	iterator insert(const_iterator pos, std::initializer_list<T> init);
+	iterator insert(const_iterator pos, node_type&& handle);
 	template<class... Args>
 	iterator emplace(const_iterator pos, Args&&... args);
+	node_type extract(const_iterator pos);
 	iterator erase(const_iterator pos);
 	iterator erase(const_iterator first, const_iterator last);
 	void push_front(const value_type& value);
@@ -159,6 +329,12 @@ public:
 	void resize(size_type count);
 	void resize(size_type count, const value_type& value);
 	void swap(list& other);
+	// Cuts [pos, end()) off into a new list; O(1) when count, the length of
+	// that range, is supplied
+	list split(const_iterator pos);
+	list split(const_iterator pos, size_type count);
+	// Cuts the whole list into k parts whose sizes differ by at most one
+	std::vector<list> split_into(size_type k);
 
 	// Operations
 	void merge(list& other);
@@ -176,30 +352,59 @@ public:
 	void remove(const value_type& value);
 	template<class UnaryPredicate>
 	void remove_if(UnaryPredicate p);
+	template<class UnaryPredicate>
+	void remove_if(UnaryPredicate p, list& removed);
 	void reverse() noexcept;
 	void unique();
 	template<class BinaryPredicate>
 	void unique(BinaryPredicate p);
+	template<class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>>
+	void unique_all(Hash hash = Hash(), KeyEqual equal = KeyEqual());
 	void sort();
 	template<class Compare>
 	void sort(Compare comp);
+	template<class KeyFn>
+	void sort_by_key(KeyFn key);
+	template<class UnaryPredicate>
+	iterator partition(UnaryPredicate p);
+	template<class UnaryPredicate>
+	iterator stable_partition(UnaryPredicate p);
+	void set_union(list& other);
+	void set_union(list&& other);
+	template<class Compare>
+	void set_union(list& other, Compare comp);
+	template<class Compare>
+	void set_union(list&& other, Compare comp);
+	void set_intersection(const list& other);
+	template<class Compare>
+	void set_intersection(const list& other, Compare comp);
+	void set_difference(const list& other);
+	template<class Compare>
+	void set_difference(const list& other, Compare comp);
+	template<class UnaryFunction>
+	UnaryFunction for_each_prefetched(UnaryFunction f, size_type distance = BLK_LIST_PREFETCH_DISTANCE);
+	template<class UnaryFunction>
+	UnaryFunction for_each_prefetched(UnaryFunction f, size_type distance = BLK_LIST_PREFETCH_DISTANCE) const;
 
-private:
-	using node_type = ListNode<T>;
-	using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
-
-	void unique_equal(std::function<bool(const T& left, const T& right)> equalFunc);
-	node_type* allocateNode(node_type* prev, node_type* next);
-	node_type* allocateHeadNode();
-	node_type* insertNode(node_type* prev, node_type* next);
-	node_type* destroyNode(node_type* node);
+protected:
+	using list_node_type = ListNode<T>;
+	using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<list_node_type>;
+
+	list_node_type* allocateNode(list_node_type* prev, list_node_type* next);
+	list_node_type* allocateHeadNode();
+	list_node_type* insertNode(list_node_type* prev, list_node_type* next);
+	void attachNode(list_node_type* node, list_node_type* next);
+	list_node_type* destroyNode(list_node_type* node);
+	size_type destroyChain(list_node_type* first, list_node_type* last);
+	void appendChain(list_node_type* first);
 	void commonSplice(const_iterator pos, list& other);
 	void commonSplice(const_iterator pos, list& other, const_iterator it);
 	void commonSplice(const_iterator pos, list& other, const_iterator first, const_iterator last);
-	void sort(node_type*& first, node_type*& last, std::function<bool(const T& left, const T& right)> lessFunc);
+	void commonSplice(const_iterator pos, list& other, const_iterator first, const_iterator last, size_type count);
+	void transferNodes(const_iterator pos, list& other, const_iterator first, const_iterator last);
 
 	allocator_type m_alloc;
-	node_type* m_headNode;
+	list_node_type* m_headNode;
 	size_type m_size;
 };
 
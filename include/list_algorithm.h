@@ -0,0 +1,56 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "list.h"
+
+namespace blk
+{
+// Runs task(i) for every i in [0, tasks) on up to `threads` std::thread
+// workers that claim indices from a shared counter; the first exception
+// thrown by a task is rethrown once every worker has joined
+template<class Task>
+void parallelRun(size_t tasks, size_t threads, Task task);
+// Number of workers to use for a requested count, where 0 means one per core
+inline size_t workerCount(size_t threads);
+
+// Merges every sorted list of `lists`, and the sorted contents of
+// `destination`, into `destination` in O(n log k) by relinking nodes through
+// splice; the inputs end up empty and equivalent elements keep the order of
+// destination first, then the order of the lists in the range
+template<class List, class Range>
+void merge_all(List& destination, Range& lists);
+template<class List, class Range, class Compare>
+void merge_all(List& destination, Range& lists, Compare comp);
+
+// Parallel variant: splitter keys sampled from the inputs cut every list into
+// `threads` key ranges (0 picks one per core) that are merged concurrently
+// and concatenated; the allocators of the lists must be safe to use from
+// several threads. If an exception escapes, every element is left in
+// destination in no particular order
+template<class T, class Allocator, class Range, class Compare>
+void merge_all(list<T, Allocator>& destination, Range& lists, Compare comp, size_t threads);
+
+// Apply f to every element, or reduce the transformed elements, on `threads`
+// workers (0 picks std::thread::hardware_concurrency()); one walk cuts the
+// list into a few chunks per worker, which claim them from a shared counter.
+// Chunk results are combined in list order, so an associative reduce gives
+// the same result for any number of threads
+template<class List, class UnaryFunction>
+void parallel_for_each(List& list, UnaryFunction f, size_t threads = 0);
+template<class List, class T, class BinaryReduce, class UnaryTransform>
+T parallel_transform_reduce(const List& list, T init, BinaryReduce reduce, UnaryTransform transform, size_t threads = 0);
+
+// Splits [first, first + size) into at most `chunks` consecutive ranges of
+// nearly equal length; returns the chunk boundaries, first and last included
+template<class Iterator>
+std::vector<Iterator> chunkBounds(Iterator first, size_t size, size_t chunks);
+
+}
+
+#include "../src/list_algorithm.cpp"
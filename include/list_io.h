@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include "list.h"
+
+// Size of the buffer save() gathers elements into and load() reads them from
+#ifndef BLK_LIST_IO_CHUNK_BYTES
+#define BLK_LIST_IO_CHUNK_BYTES (1 << 20)
+#endif
+
+namespace blk
+{
+// Binary list format: a header (magic, version, byte order mark, element
+// size, element count) followed by chunks, each an element count and the
+// elements, and a final empty chunk. Element size 0 marks elements written
+// by a user supplied writer. Integers use the byte order of the writer
+struct ListStreamHeader
+{
+	char magic[8];
+	std::uint32_t version;
+	std::uint32_t byteOrder;
+	std::uint32_t elementSize;
+	std::uint32_t reserved;
+	std::uint64_t count;
+
+	static const std::uint32_t currentVersion = 1;
+	static const std::uint32_t byteOrderMark = 0x01020304;
+};
+
+// Writes the list to out; trivially copyable elements are gathered into
+// BLK_LIST_IO_CHUNK_BYTES buffers and written with one call per chunk.
+// Throws std::runtime_error when the stream fails
+template<class List>
+void save(const List& list, std::ostream& out);
+// Same format with every element written by writer(out, element)
+template<class List, class Writer>
+void save(const List& list, std::ostream& out, Writer writer);
+
+// Replaces the contents of list with the elements read from in, one chunk at
+// a time; throws std::runtime_error on malformed or truncated input, in which
+// case the list is left empty
+template<class List>
+void load(List& list, std::istream& in);
+// Same format with every element produced by reader(in)
+template<class List, class Reader>
+void load(List& list, std::istream& in, Reader reader);
+
+// Stream helpers shared by save and load; they throw std::runtime_error
+// when the stream fails or the header does not describe the expected data
+inline void writeListBytes(std::ostream& out, const void* data, size_t bytes);
+inline void readListBytes(std::istream& in, void* data, size_t bytes);
+inline void writeListHeader(std::ostream& out, std::uint32_t elementSize, std::uint64_t count);
+inline std::uint64_t readListHeader(std::istream& in, std::uint32_t elementSize);
+// Number of elements of T that fit in one chunk buffer
+template<class T>
+size_t listChunkElements();
+template<class List, class ReadChunk>
+void loadListChunks(List& list, std::istream& in, std::uint64_t count, ReadChunk readChunk);
+
+}
+
+#include "../src/list_io.cpp"
@@ -0,0 +1,318 @@
+#pragma once
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "list.h"
+
+namespace blk
+{
+// Lazy views over lists and over other views. Each view holds the range it
+// reads from (a pointer to an lvalue container, or a copy of a view or of an
+// rvalue container) together with its functors, and computes elements only
+// while it is iterated, so a chain of views allocates nothing until a
+// terminal such as to_list() walks it once. Iterators refer to the functors
+// of the view that produced them and must not outlive it
+
+// Base of every view type; views are copied into the views built on them
+struct ListViewBase {};
+
+template<class Range>
+using ListViewIterator = decltype(std::declval<const Range&>().begin());
+template<class Range>
+using ListViewValue = typename std::iterator_traits<ListViewIterator<Range>>::value_type;
+
+template<class Container>
+class ListRefView : public ListViewBase
+{
+public:
+	using iterator = decltype(std::declval<Container&>().begin());
+
+	explicit ListRefView(Container& container) noexcept;
+
+	iterator begin() const;
+	iterator end() const;
+
+private:
+	Container *m_container;
+};
+
+// Lvalue containers are referenced, views and rvalue containers are stored
+template<class Range>
+using ListViewStorage = typename std::conditional<
+	std::is_lvalue_reference<Range>::value && !std::is_base_of<ListViewBase, typename std::decay<Range>::type>::value,
+	ListRefView<typename std::remove_reference<Range>::type>,
+	typename std::decay<Range>::type>::type;
+
+// Pair of iterators, the element type of chunk views
+template<class Iterator>
+class ListSubrange : public ListViewBase
+{
+public:
+	using iterator = Iterator;
+
+	ListSubrange();
+	ListSubrange(Iterator first, Iterator last);
+
+	iterator begin() const;
+	iterator end() const;
+	bool empty() const;
+	size_t size() const;
+
+private:
+	Iterator m_first;
+	Iterator m_last;
+};
+
+template<class Iterator, class Predicate>
+class ListFilterIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = typename std::iterator_traits<Iterator>::value_type;
+	using pointer = typename std::iterator_traits<Iterator>::pointer;
+	using reference = typename std::iterator_traits<Iterator>::reference;
+	using difference_type = std::ptrdiff_t;
+
+	ListFilterIterator();
+	ListFilterIterator(Iterator it, Iterator last, const Predicate* pred);
+
+	bool operator==(const ListFilterIterator& it) const;
+	bool operator!=(const ListFilterIterator& it) const;
+
+	ListFilterIterator& operator++();
+	ListFilterIterator operator++(int);
+
+	reference operator*() const;
+
+private:
+	void skip();
+
+	Iterator m_it;
+	Iterator m_last;
+	const Predicate *m_pred;
+};
+
+template<class Iterator, class Function>
+class ListTransformIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using reference = decltype(std::declval<const Function&>()(*std::declval<Iterator>()));
+	using value_type = typename std::decay<reference>::type;
+	using pointer = void;
+	using difference_type = std::ptrdiff_t;
+
+	ListTransformIterator();
+	ListTransformIterator(Iterator it, const Function* fn);
+
+	bool operator==(const ListTransformIterator& it) const;
+	bool operator!=(const ListTransformIterator& it) const;
+
+	ListTransformIterator& operator++();
+	ListTransformIterator operator++(int);
+
+	reference operator*() const;
+
+private:
+	Iterator m_it;
+	const Function *m_fn;
+};
+
+template<class Iterator, class Predicate>
+class ListTakeWhileIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = typename std::iterator_traits<Iterator>::value_type;
+	using pointer = typename std::iterator_traits<Iterator>::pointer;
+	using reference = typename std::iterator_traits<Iterator>::reference;
+	using difference_type = std::ptrdiff_t;
+
+	ListTakeWhileIterator();
+	ListTakeWhileIterator(Iterator it, Iterator last, const Predicate* pred);
+
+	bool operator==(const ListTakeWhileIterator& it) const;
+	bool operator!=(const ListTakeWhileIterator& it) const;
+
+	ListTakeWhileIterator& operator++();
+	ListTakeWhileIterator operator++(int);
+
+	reference operator*() const;
+
+private:
+	void check();
+
+	Iterator m_it;
+	Iterator m_last;
+	const Predicate *m_pred;
+};
+
+template<class Iterator>
+class ListChunkIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = ListSubrange<Iterator>;
+	using pointer = void;
+	using reference = ListSubrange<Iterator>;
+	using difference_type = std::ptrdiff_t;
+
+	ListChunkIterator();
+	ListChunkIterator(Iterator it, Iterator last, size_t count);
+
+	bool operator==(const ListChunkIterator& it) const;
+	bool operator!=(const ListChunkIterator& it) const;
+
+	ListChunkIterator& operator++();
+	ListChunkIterator operator++(int);
+
+	reference operator*() const;
+
+private:
+	Iterator chunkEnd() const;
+
+	Iterator m_it;
+	Iterator m_next;
+	Iterator m_last;
+	size_t m_count;
+};
+
+// Walks two ranges in step and stops at the end of the shorter one
+template<class Iterator1, class Iterator2>
+class ListZipIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = std::pair<typename std::iterator_traits<Iterator1>::value_type, typename std::iterator_traits<Iterator2>::value_type>;
+	using pointer = void;
+	using reference = std::pair<typename std::iterator_traits<Iterator1>::reference, typename std::iterator_traits<Iterator2>::reference>;
+	using difference_type = std::ptrdiff_t;
+
+	ListZipIterator();
+	ListZipIterator(Iterator1 first, Iterator1 firstLast, Iterator2 second, Iterator2 secondLast);
+
+	bool operator==(const ListZipIterator& it) const;
+	bool operator!=(const ListZipIterator& it) const;
+
+	ListZipIterator& operator++();
+	ListZipIterator operator++(int);
+
+	reference operator*() const;
+
+private:
+	void check();
+
+	Iterator1 m_first;
+	Iterator1 m_firstLast;
+	Iterator2 m_second;
+	Iterator2 m_secondLast;
+};
+
+template<class Base, class Predicate>
+class ListFilterView : public ListViewBase
+{
+public:
+	using iterator = ListFilterIterator<ListViewIterator<Base>, Predicate>;
+
+	ListFilterView(Base base, Predicate pred);
+
+	// O(distance to the first accepted element)
+	iterator begin() const;
+	iterator end() const;
+
+private:
+	Base m_base;
+	Predicate m_pred;
+};
+
+template<class Base, class Function>
+class ListTransformView : public ListViewBase
+{
+public:
+	using iterator = ListTransformIterator<ListViewIterator<Base>, Function>;
+
+	ListTransformView(Base base, Function fn);
+
+	iterator begin() const;
+	iterator end() const;
+
+private:
+	Base m_base;
+	Function m_fn;
+};
+
+template<class Base, class Predicate>
+class ListTakeWhileView : public ListViewBase
+{
+public:
+	using iterator = ListTakeWhileIterator<ListViewIterator<Base>, Predicate>;
+
+	ListTakeWhileView(Base base, Predicate pred);
+
+	iterator begin() const;
+	iterator end() const;
+
+private:
+	Base m_base;
+	Predicate m_pred;
+};
+
+template<class Base>
+class ListChunkView : public ListViewBase
+{
+public:
+	using iterator = ListChunkIterator<ListViewIterator<Base>>;
+
+	ListChunkView(Base base, size_t count);
+
+	iterator begin() const;
+	iterator end() const;
+
+private:
+	Base m_base;
+	size_t m_count;
+};
+
+template<class Base1, class Base2>
+class ListZipView : public ListViewBase
+{
+public:
+	using iterator = ListZipIterator<ListViewIterator<Base1>, ListViewIterator<Base2>>;
+
+	ListZipView(Base1 first, Base2 second);
+
+	iterator begin() const;
+	iterator end() const;
+
+private:
+	Base1 m_first;
+	Base2 m_second;
+};
+
+// View factories; they accept lists, any other container with begin() and
+// end(), and views
+template<class Range, class Predicate>
+ListFilterView<ListViewStorage<Range>, typename std::decay<Predicate>::type> filter(Range&& range, Predicate&& pred);
+template<class Range, class Function>
+ListTransformView<ListViewStorage<Range>, typename std::decay<Function>::type> transform(Range&& range, Function&& fn);
+template<class Range, class Predicate>
+ListTakeWhileView<ListViewStorage<Range>, typename std::decay<Predicate>::type> take_while(Range&& range, Predicate&& pred);
+// Consecutive subranges of count elements, the last one possibly shorter;
+// a count of 0 gives an empty view
+template<class Range>
+ListChunkView<ListViewStorage<Range>> chunk(Range&& range, size_t count);
+template<class Range1, class Range2>
+ListZipView<ListViewStorage<Range1>, ListViewStorage<Range2>> zip(Range1&& first, Range2&& second);
+
+// Walks the range once and builds a list of its elements, so a chain of
+// views allocates only the nodes of the result
+template<class Range>
+list<ListViewValue<Range>> to_list(const Range& range);
+template<class Range, class Allocator>
+list<typename std::allocator_traits<Allocator>::value_type, Allocator> to_list(const Range& range, const Allocator& alloc);
+
+}
+
+#include "../src/list_view.cpp"
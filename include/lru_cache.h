@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include "list.h"
+
+namespace blk
+{
+template<class K, class V, class Hash, class Allocator>
+class lru_cache;
+
+// Cache entry; the list node that holds it is also the hash chain link,
+// so every entry costs a single allocation
+template<class K, class V>
+struct LruCacheEntry
+{
+	template<class KeyArg, class... Args>
+	LruCacheEntry(size_t hash, KeyArg&& key, Args&&... args);
+
+	const K key;
+	V value;
+
+private:
+	template<class, class, class, class>
+	friend class lru_cache;
+
+	ListNode<LruCacheEntry> *bucketNext;
+	size_t hash;
+};
+
+// Fixed capacity key/value cache that evicts the least recently used entry;
+// iteration goes from the most to the least recently used entry
+template<class K, class V, class Hash = std::hash<K>, class Allocator = std::allocator<std::pair<const K, V>>>
+class lru_cache
+{
+public:
+	using key_type = K;
+	using mapped_type = V;
+	using value_type = LruCacheEntry<K, V>;
+	using hasher = Hash;
+	using allocator_type = Allocator;
+	using size_type = size_t;
+
+private:
+	using entry_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>;
+	using list_type = list<value_type, entry_allocator_type>;
+	using entry_node_type = ListNode<value_type>;
+	using bucket_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<entry_node_type*>;
+
+public:
+	using iterator = typename list_type::iterator;
+	using const_iterator = typename list_type::const_iterator;
+
+	// Constructors
+	explicit lru_cache(size_type capacity, const Hash& hash = Hash(), const Allocator& alloc = Allocator());
+	lru_cache(const lru_cache& other) = delete;
+	lru_cache(lru_cache&& other) = default;
+	lru_cache& operator=(const lru_cache& other) = delete;
+	allocator_type get_allocator() const;
+	hasher hash_function() const;
+
+	// Iterators, most recently used first
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+
+	// Capacity
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	size_type capacity() const noexcept;
+
+	// Lookup; get and touch mark the entry as most recently used, find and
+	// contains leave the recency order alone
+	mapped_type* get(const key_type& key);
+	iterator find(const key_type& key);
+	const_iterator find(const key_type& key) const;
+	bool contains(const key_type& key) const;
+	void touch(const_iterator pos);
+
+	// Modifiers; inserting into a full cache evicts the least recently used entry
+	template<class... Args>
+	std::pair<iterator, bool> emplace(const key_type& key, Args&&... args);
+	iterator put(const key_type& key, const mapped_type& value);
+	iterator put(const key_type& key, mapped_type&& value);
+	iterator erase(const_iterator pos);
+	size_type erase(const key_type& key);
+	void clear() noexcept;
+
+	// Evicts up to count least recently used entries, handing each one to
+	// callback(value_type&) before it is destroyed
+	template<class Callback>
+	size_type evict(size_type count, Callback callback);
+	size_type evict(size_type count);
+
+private:
+	size_type bucketOf(size_t hash) const;
+	entry_node_type* findNode(const key_type& key, size_t hash) const;
+	void linkBucket(entry_node_type* node);
+	void unlinkBucket(entry_node_type* node);
+	void rehash(size_type bucketCount);
+
+	list_type m_list;
+	std::vector<entry_node_type*, bucket_allocator_type> m_buckets;
+	size_type m_capacity;
+	unsigned m_shift;
+	hasher m_hash;
+};
+
+}
+
+#include "../src/lru_cache.cpp"
@@ -0,0 +1,164 @@
+#pragma once
+
+#if !defined(_WIN32)
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace blk
+{
+// Node of a mapped_list; links are byte offsets relative to the node itself,
+// so the file can be mapped at any address
+template<class T>
+struct MappedListNode
+{
+	std::int64_t next;
+	std::int64_t prev;
+	T val;
+};
+
+// Start of a mapped_list file; offsets are measured from the file start
+struct MappedListHeader
+{
+	char magic[8];
+	std::uint32_t version;
+	std::uint32_t nodeSize;
+	std::uint64_t capacity;
+	std::uint64_t size;
+	std::uint64_t freeList;
+	std::uint64_t bump;
+};
+
+template<class T, bool IsConst = false>
+class MappedListIterator
+{
+public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = T;
+	using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+	using reference = typename std::conditional<IsConst, const T&, T&>::type;
+	using difference_type = std::ptrdiff_t;
+
+	MappedListIterator();
+	MappedListIterator(const MappedListIterator<value_type, false>& it);
+	explicit MappedListIterator(MappedListNode<value_type>* node);
+
+	template<bool B>
+	bool operator==(const MappedListIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator!=(const MappedListIterator<value_type, B>& it) const;
+
+	MappedListIterator& operator++();
+	MappedListIterator& operator--();
+	MappedListIterator operator++(int);
+	MappedListIterator operator--(int);
+
+	reference operator*() const;
+	pointer operator->() const;
+
+	MappedListNode<value_type> * getNode() const;
+
+private:
+	MappedListNode<T> *m_item;
+};
+
+// List of trivially copyable elements stored in a memory-mapped file.
+// Nodes come from an in-file free list, so reopening the file is a single
+// mmap with no deserialization. checkpoint() flushes the mapping with msync;
+// changes made after the last checkpoint may be lost, or leave the file
+// inconsistent, if the process dies. When the file grows it is remapped,
+// which invalidates iterators and references
+template<class T>
+class mapped_list
+{
+	static_assert(std::is_trivially_copyable<T>::value, "mapped_list requires a trivially copyable element type");
+
+public:
+	using value_type = T;
+	using iterator = MappedListIterator<value_type>;
+	using const_iterator = MappedListIterator<value_type, true>;
+	using size_type = size_t;
+	using reference = value_type & ;
+	using const_reference = const value_type&;
+	using difference_type = std::ptrdiff_t;
+
+	// Opens the list stored in path, creating the file when it does not
+	// exist; throws std::system_error on I/O failures and
+	// std::runtime_error when the file holds something else
+	explicit mapped_list(const std::string& path, size_type initialCapacity = 1024);
+	mapped_list(const mapped_list&) = delete;
+	mapped_list(mapped_list&& other) noexcept;
+	mapped_list& operator=(const mapped_list&) = delete;
+	~mapped_list();
+
+	// Element access
+	reference front();
+	const_reference front() const;
+	reference back();
+	const_reference back() const;
+
+	// Iterators
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator cbegin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+	const_iterator cend() const noexcept;
+
+	// Capacity
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	// Number of nodes the file holds without growing
+	size_type capacity() const noexcept;
+
+	// Modifiers
+	void clear() noexcept;
+	iterator insert(const_iterator pos, const value_type& value);
+	iterator erase(const_iterator pos);
+	void push_front(const value_type& value);
+	void push_back(const value_type& value);
+	void pop_front();
+	void pop_back();
+
+	// Flushes the mapping to the file; with async the call only schedules
+	// the write-back
+	void checkpoint(bool async = false);
+
+private:
+	using node_type = MappedListNode<T>;
+
+	static const std::uint32_t formatVersion = 1;
+
+	static node_type* follow(node_type* node, std::int64_t offset);
+	static std::int64_t offsetTo(const node_type* from, const node_type* to);
+	static std::uint64_t headOffset();
+
+	MappedListHeader* header() const;
+	node_type* headNode() const;
+	node_type* nodeAt(std::uint64_t offset) const;
+	void link(node_type* node, node_type* pos);
+	node_type* allocateNode();
+	void freeNode(node_type* node);
+	void map(std::uint64_t bytes);
+	void grow();
+
+	int m_fd;
+	char *m_base;
+	std::uint64_t m_mapped;
+};
+
+}
+
+#include "../src/mapped_list.cpp"
+
+#endif
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "list.h"
+
+namespace blk
+{
+// Node of a pairing_heap. Like ListNode it chains siblings through next and
+// prev; the first child of a node keeps its parent in prev
+template<class T>
+struct PairingHeapNode
+{
+	T val;
+	PairingHeapNode<T> *next;
+	PairingHeapNode<T> *prev;
+	PairingHeapNode<T> *child;
+};
+
+// Refers to an element of a pairing_heap until it is popped or erased
+template<class T>
+class PairingHeapHandle
+{
+public:
+	using value_type = T;
+
+	PairingHeapHandle();
+	explicit PairingHeapHandle(PairingHeapNode<value_type>* node);
+
+	bool operator==(const PairingHeapHandle& handle) const;
+	bool operator!=(const PairingHeapHandle& handle) const;
+
+	const value_type& operator*() const;
+	const value_type* operator->() const;
+
+	PairingHeapNode<value_type> * getNode() const;
+
+private:
+	PairingHeapNode<T> *m_node;
+};
+
+// Priority queue of heap-ordered node trees. As in std::priority_queue,
+// top() is an element no other one ranks above with Compare. push, meld and
+// top are O(1), pop and erase amortized O(log n) and decrease_key o(log n)
+// amortized. Handles stay valid until their element leaves the heap, also
+// when it is melded into another heap whose allocator can free its nodes
+// (see ListNodeTransfer); otherwise meld moves the values into new nodes
+template<class T, class Compare = std::less<T>, class Allocator = std::allocator<T>>
+class pairing_heap
+{
+public:
+	using value_type = T;
+	using value_compare = Compare;
+	using allocator_type = Allocator;
+	using handle_type = PairingHeapHandle<value_type>;
+	using size_type = size_t;
+	using reference = value_type & ;
+	using const_reference = const value_type&;
+
+	// Constructors and destructor
+	pairing_heap();
+	explicit pairing_heap(const Compare& comp, const Allocator& alloc = Allocator());
+	explicit pairing_heap(const Allocator& alloc);
+	pairing_heap(const pairing_heap& other);
+	pairing_heap(pairing_heap&& other) noexcept;
+	~pairing_heap();
+
+	// Assignments and getters
+	pairing_heap& operator=(const pairing_heap& other);
+	pairing_heap& operator=(pairing_heap&& other);
+	allocator_type get_allocator() const;
+	value_compare value_comp() const;
+
+	// Element access and capacity
+	const_reference top() const;
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+
+	// Modifiers
+	void clear() noexcept;
+	handle_type push(const value_type& value);
+	handle_type push(value_type&& value);
+	template<class... Args>
+	handle_type emplace(Args&&... args);
+	void pop();
+	void erase(handle_type handle);
+	// Replaces the element with a value ranking at least as high, i.e. one
+	// that does not compare less than the old value (a smaller key with
+	// std::greater); throws std::invalid_argument otherwise
+	void decrease_key(handle_type handle, const value_type& value);
+	void decrease_key(handle_type handle, value_type&& value);
+	// Moves every element of other into this heap, leaving other empty
+	void meld(pairing_heap& other);
+	void meld(pairing_heap&& other);
+	void swap(pairing_heap& other);
+
+private:
+	using node_type = PairingHeapNode<T>;
+	using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+
+	template<class... Args>
+	node_type* createNode(Args&&... args);
+	void destroyNode(node_type* node) noexcept;
+	void destroyTree(node_type* root) noexcept;
+	// Copies a tree into nodes of this heap; Value is const T& or T&&
+	template<class Value>
+	node_type* cloneTree(node_type* root);
+	node_type* link(node_type* left, node_type* right);
+	node_type* mergePairs(node_type* first);
+	void detach(node_type* node) noexcept;
+	void insertRoot(node_type* node);
+	template<class Value>
+	void raise(node_type* node, Value&& value);
+
+	allocator_type m_alloc;
+	value_compare m_comp;
+	node_type *m_root;
+	size_type m_size;
+};
+
+}
+
+namespace std
+{
+	template<class T, class Compare, class Alloc>
+	void swap(blk::pairing_heap<T, Compare, Alloc>& left, blk::pairing_heap<T, Compare, Alloc>& right);
+}
+
+#include "../src/pairing_heap.cpp"
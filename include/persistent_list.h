@@ -0,0 +1,188 @@
+#pragma once
+
+#include <atomic>
+#include "list.h"
+
+namespace blk
+{
+// Immutable node shared between list versions; freed by whichever version
+// drops the last reference
+template<class T>
+struct PersistentListNode
+{
+	T val;
+	std::atomic<size_t> refs;
+	PersistentListNode<T> *next;
+};
+
+template<class T>
+class PersistentListIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = T;
+	using pointer = const T*;
+	using reference = const T&;
+	using difference_type = std::ptrdiff_t;
+
+	PersistentListIterator();
+	explicit PersistentListIterator(PersistentListNode<value_type>* node);
+
+	bool operator==(const PersistentListIterator& it) const;
+	bool operator!=(const PersistentListIterator& it) const;
+
+	PersistentListIterator& operator++();
+	PersistentListIterator operator++(int);
+
+	reference operator*() const;
+	pointer operator->() const;
+
+	PersistentListNode<value_type> * getNode() const;
+
+private:
+	PersistentListNode<T> *m_item;
+};
+
+template<class T, class Allocator>
+class PersistentListTransient;
+
+// Singly linked list whose versions are immutable and share their common
+// tails through atomic reference counts. Copying a version is O(1), and
+// every modifier returns a new version that copies only the nodes in front
+// of the change. Any number of threads may read and copy the same version
+// without locking; a single persistent_list object still must not be
+// assigned while other threads read it, just like std::shared_ptr
+template<class T, class Allocator = std::allocator<T>>
+class persistent_list
+{
+public:
+	using value_type = T;
+	using allocator_type = Allocator;
+	using iterator = PersistentListIterator<value_type>;
+	using const_iterator = iterator;
+	using size_type = size_t;
+	using reference = const value_type&;
+	using const_reference = const value_type&;
+	using difference_type = std::ptrdiff_t;
+	using transient_type = PersistentListTransient<T, Allocator>;
+
+	// Constructors and destructor
+	persistent_list();
+	explicit persistent_list(const Allocator& alloc);
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	persistent_list(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+	persistent_list(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+	persistent_list(const persistent_list& other) noexcept;
+	persistent_list(persistent_list&& other) noexcept;
+	~persistent_list();
+
+	persistent_list& operator=(const persistent_list& other) noexcept;
+	persistent_list& operator=(persistent_list&& other) noexcept;
+	allocator_type get_allocator() const;
+
+	// Element access
+	const_reference front() const;
+
+	// Iterators
+	const_iterator begin() const noexcept;
+	const_iterator cbegin() const noexcept;
+	const_iterator end() const noexcept;
+	const_iterator cend() const noexcept;
+
+	// Capacity
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+
+	// New versions; O(1) at the front, otherwise O(distance from the front)
+	persistent_list push_front(const value_type& value) const;
+	persistent_list push_front(value_type&& value) const;
+	template<class... Args>
+	persistent_list emplace_front(Args&&... args) const;
+	persistent_list pop_front() const;
+	persistent_list push_back(const value_type& value) const;
+	persistent_list insert(const_iterator pos, const value_type& value) const;
+	persistent_list erase(const_iterator pos) const;
+	persistent_list set(const_iterator pos, const value_type& value) const;
+	// Inserts the elements of other before pos; other is shared as a whole
+	// when pos is end()
+	persistent_list splice(const_iterator pos, const persistent_list& other) const;
+
+	// Mutable builder for batched edits, starting from this version
+	transient_type transient() const;
+
+private:
+	friend class PersistentListTransient<T, Allocator>;
+
+	using node_type = PersistentListNode<T>;
+	using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+
+	persistent_list(node_type* head, size_type size, const Allocator& alloc) noexcept;
+
+	template<class... Args>
+	node_type* allocateNode(node_type* next, Args&&... args) const;
+	static void retain(node_type* node) noexcept;
+	void release(node_type* node) const noexcept;
+	node_type* copyRange(node_type* first, node_type* last, node_type* suffix) const;
+
+	allocator_type m_alloc;
+	node_type *m_head;
+	size_type m_size;
+};
+
+// Builder that owns its nodes exclusively until persistent() hands them
+// over; nodes shared with other versions are copied the first time an edit
+// has to change them
+template<class T, class Allocator>
+class PersistentListTransient
+{
+public:
+	using value_type = T;
+	using size_type = size_t;
+	using const_iterator = PersistentListIterator<value_type>;
+	using list_type = persistent_list<T, Allocator>;
+
+	explicit PersistentListTransient(const Allocator& alloc = Allocator());
+	explicit PersistentListTransient(const list_type& from);
+	PersistentListTransient(const PersistentListTransient&) = delete;
+	PersistentListTransient(PersistentListTransient&& other) noexcept;
+	PersistentListTransient& operator=(const PersistentListTransient&) = delete;
+	~PersistentListTransient();
+
+	const_iterator begin() const noexcept;
+	const_iterator end() const noexcept;
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	T& front();
+	T& back();
+
+	void push_front(const value_type& value);
+	void push_front(value_type&& value);
+	template<class... Args>
+	T& emplace_front(Args&&... args);
+	void push_back(const value_type& value);
+	void push_back(value_type&& value);
+	template<class... Args>
+	T& emplace_back(Args&&... args);
+	void pop_front();
+
+	// Freezes the contents into a new version and leaves the builder empty
+	list_type persistent();
+
+private:
+	using node_type = PersistentListNode<T>;
+
+	void makeUnique();
+
+	list_type m_list;
+	node_type *m_tail;
+	bool m_unique;
+};
+
+template<class T, class Alloc>
+bool operator==(const persistent_list<T, Alloc>& left, const persistent_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator!=(const persistent_list<T, Alloc>& left, const persistent_list<T, Alloc>& right);
+
+}
+
+#include "../src/persistent_list.cpp"
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "list.h"
+
+namespace blk
+{
+// Iterator of reversible_list; carries the direction it walks in, so a
+// reversed list simply hands out iterators that follow prev links
+template<class T, bool IsConst = false>
+class ReversibleListIterator
+{
+public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = T;
+	using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+	using reference = typename std::conditional<IsConst, const T&, T&>::type;
+	using difference_type = std::ptrdiff_t;
+
+	ReversibleListIterator();
+	ReversibleListIterator(const ReversibleListIterator<value_type, false>& it);
+	ReversibleListIterator(ListNode<value_type>* node, bool reversed);
+
+	template<bool B>
+	bool operator==(const ReversibleListIterator<value_type, B>& it) const;
+	template<bool B>
+	bool operator!=(const ReversibleListIterator<value_type, B>& it) const;
+
+	ReversibleListIterator& operator++();
+	ReversibleListIterator& operator--();
+	ReversibleListIterator operator++(int);
+	ReversibleListIterator operator--(int);
+
+	reference operator*() const;
+	pointer operator->() const;
+
+	ListNode<value_type> * getNode() const;
+	bool isReversed() const;
+
+private:
+	ListNode<T> *m_item;
+	bool m_reversed;
+};
+
+// List whose reverse() is O(1): it only flips a direction flag that the
+// iterators and the end-related operations consult. Kept apart from
+// blk::list so that plain lists do not pay for the flag on every step
+template<class T, class Allocator = std::allocator<T>>
+class reversible_list
+{
+public:
+	using value_type = T;
+	using allocator_type = Allocator;
+	using iterator = ReversibleListIterator<value_type>;
+	using const_iterator = ReversibleListIterator<value_type, true>;
+	using reverse_iterator = iterator;
+	using const_reverse_iterator = const_iterator;
+	using size_type = size_t;
+	using reference = value_type & ;
+	using const_reference = const value_type&;
+	using pointer = typename std::allocator_traits<Allocator>::pointer;
+	using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+	using difference_type = std::ptrdiff_t;
+
+	// Constructors
+	reversible_list();
+	explicit reversible_list(const Allocator& alloc);
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	reversible_list(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+	reversible_list(const reversible_list& other);
+	reversible_list(reversible_list&& other);
+	reversible_list(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+
+	// Assignments and allocator getter
+	reversible_list& operator=(const reversible_list& other);
+	reversible_list& operator=(reversible_list&& other);
+	allocator_type get_allocator() const;
+
+	// Element access
+	reference front();
+	const_reference front() const;
+	reference back();
+	const_reference back() const;
+
+	// Iterators
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator cbegin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+	const_iterator cend() const noexcept;
+	reverse_iterator rbegin() noexcept;
+	const_reverse_iterator rbegin() const noexcept;
+	reverse_iterator rend() noexcept;
+	const_reverse_iterator rend() const noexcept;
+
+	// Capacity
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	size_type max_size() const noexcept;
+
+	// Modifiers
+	void clear() noexcept;
+	iterator insert(const_iterator pos, const value_type& value);
+	iterator insert(const_iterator pos, value_type&& value);
+	template<class... Args>
+	iterator emplace(const_iterator pos, Args&&... args);
+	iterator erase(const_iterator pos);
+	iterator erase(const_iterator first, const_iterator last);
+	void push_front(const value_type& value);
+	void push_front(value_type&& value);
+	void push_back(const value_type& value);
+	void push_back(value_type&& value);
+	template<class... Args>
+	reference emplace_front(Args&&... args);
+	template<class... Args>
+	reference emplace_back(Args&&... args);
+	void pop_front();
+	void pop_back();
+	void swap(reversible_list& other);
+
+	// Operations
+	void reverse() noexcept;
+	bool is_reversed() const noexcept;
+	// Relinks the nodes into their logical order in O(n) and clears the flag
+	void normalize() noexcept;
+	void sort();
+	template<class Compare>
+	void sort(Compare comp);
+
+private:
+	using list_type = list<T, Allocator>;
+	using list_node_type = ListNode<T>;
+
+	list_node_type* headNode() const;
+	typename list_type::const_iterator physicalPos(const_iterator pos) const;
+
+	list_type m_list;
+	bool m_reversed;
+};
+
+template<class T, class Alloc>
+bool operator==(const reversible_list<T, Alloc>& left, const reversible_list<T, Alloc>& right);
+template<class T, class Alloc>
+bool operator!=(const reversible_list<T, Alloc>& left, const reversible_list<T, Alloc>& right);
+
+}
+
+namespace std
+{
+	template<class T, class Alloc>
+	void swap(blk::reversible_list<T, Alloc>& left, blk::reversible_list<T, Alloc>& right);
+}
+
+#include "../src/reversible_list.cpp"
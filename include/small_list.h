@@ -0,0 +1,152 @@
+#pragma once
+
+#include <type_traits>
+#include <vector>
+#include "list.h"
+
+namespace blk
+{
+// Fixed set of node slots owned by a container, threaded into a free list
+struct SmallListArena
+{
+	char *begin;
+	char *end;
+	void *freeSlot;
+	size_t slotSize;
+	size_t slotAlign;
+	size_t used;
+};
+
+// Hands out arena slots first and falls back to the upstream allocator
+template<class T, class Allocator>
+class SmallListAllocator
+{
+public:
+	using value_type = T;
+	using upstream_type = Allocator;
+	using propagate_on_container_copy_assignment = std::false_type;
+	using propagate_on_container_move_assignment = std::false_type;
+	using propagate_on_container_swap = std::false_type;
+
+	SmallListAllocator();
+	SmallListAllocator(SmallListArena* arena, const Allocator& upstream);
+	template<class U>
+	SmallListAllocator(const SmallListAllocator<U, Allocator>& other);
+
+	T* allocate(size_t cnt);
+	void deallocate(T* ptr, size_t cnt);
+
+	bool owns(const void* ptr) const;
+	SmallListArena* arena() const;
+	const upstream_type& upstream() const;
+
+private:
+	using upstream_traits = typename std::allocator_traits<Allocator>::template rebind_traits<T>;
+	using upstream_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+	SmallListArena *m_arena;
+	upstream_type m_upstream;
+};
+
+template<class T, class U, class Allocator>
+bool operator==(const SmallListAllocator<T, Allocator>& left, const SmallListAllocator<U, Allocator>& right);
+template<class T, class U, class Allocator>
+bool operator!=(const SmallListAllocator<T, Allocator>& left, const SmallListAllocator<U, Allocator>& right);
+
+// Heap nodes may change owners as long as the upstream allocators agree
+template<class T, class Allocator>
+struct ListNodeTransfer<SmallListAllocator<T, Allocator>>
+{
+	static bool canRelinkAll(const SmallListAllocator<T, Allocator>& to, const SmallListAllocator<T, Allocator>& from);
+	static bool canRelink(const SmallListAllocator<T, Allocator>& to, const SmallListAllocator<T, Allocator>& from, const void* node);
+};
+
+template<class Node, size_t Count>
+class SmallListStorage
+{
+public:
+	SmallListStorage();
+	SmallListStorage(const SmallListStorage&) = delete;
+	SmallListStorage& operator=(const SmallListStorage&) = delete;
+
+protected:
+	SmallListArena m_arena;
+
+private:
+	typename std::aligned_storage<sizeof(Node), alignof(Node)>::type m_slots[Count];
+};
+
+// List keeping its first N nodes (plus the head node) inside the object
+template<class T, size_t N, class Allocator = std::allocator<T>>
+class small_list :
+	private SmallListStorage<ListNode<T>, N + 1>,
+	public list<T, SmallListAllocator<T, Allocator>>
+{
+	using base_type = list<T, SmallListAllocator<T, Allocator>>;
+	using storage_type = SmallListStorage<ListNode<T>, N + 1>;
+
+public:
+	using typename base_type::value_type;
+	using typename base_type::allocator_type;
+	using typename base_type::size_type;
+	using typename base_type::iterator;
+	using typename base_type::const_iterator;
+	using upstream_allocator_type = Allocator;
+	using upstream_node_type = typename list<T, Allocator>::node_type;
+	// Extracted nodes are always owned by the upstream allocator, so they can
+	// outlive the list
+	using node_type = upstream_node_type;
+
+	static const size_type inline_capacity = N;
+
+	// Constructors
+	small_list();
+	explicit small_list(const Allocator& alloc);
+	explicit small_list(size_type count, const value_type& value, const Allocator& alloc = Allocator());
+	explicit small_list(size_type count, const Allocator& alloc = Allocator());
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	small_list(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+	small_list(const small_list& other);
+	small_list(const small_list& other, const Allocator& alloc);
+	small_list(small_list&& other);
+	small_list(small_list&& other, const Allocator& alloc);
+	small_list(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+
+	// Assignments
+	small_list& operator=(const small_list& other);
+	small_list& operator=(small_list&& other);
+	small_list& operator=(std::initializer_list<T> init);
+
+	// Modifiers
+	using base_type::insert;
+	// Adopts a node extracted from a list using the upstream allocator
+	iterator insert(const_iterator pos, node_type&& handle);
+	// Handles holding the arena allocator would point into the inline storage
+	iterator insert(const_iterator pos, typename base_type::node_type&& handle) = delete;
+	// Extracts an element into a node owned by the upstream allocator,
+	// moving it out of the inline storage when needed
+	node_type extract(const_iterator pos);
+	upstream_node_type extract_upstream(const_iterator pos);
+	void swap(small_list& other);
+	// Unlike list::split these move inline elements into the storage of the
+	// new lists, so they are linear in the number of elements moved
+	small_list split(const_iterator pos);
+	small_list split(const_iterator pos, size_type count);
+	std::vector<small_list> split_into(size_type k);
+
+	// Number of elements currently stored in heap nodes
+	size_type spilled() const noexcept;
+
+private:
+	allocator_type makeAllocator(const Allocator& upstream);
+};
+
+}
+
+namespace std
+{
+	template<class T, size_t N, class Alloc>
+	void swap(blk::small_list<T, N, Alloc>& left, blk::small_list<T, N, Alloc>& right);
+}
+
+#include "../src/small_list.cpp"
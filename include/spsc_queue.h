@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Alignment keeping the producer and consumer indices of an spsc_queue on
+// separate cache lines
+#ifndef BLK_CACHE_LINE_SIZE
+#define BLK_CACHE_LINE_SIZE 64
+#endif
+
+namespace blk
+{
+// Bounded wait-free queue between one producer thread and one consumer
+// thread. Elements live in an in-object ring of Capacity slots, so nothing is
+// allocated after construction. Each side owns one index and keeps a cached
+// copy of the other, reading the remote index only when the cached one makes
+// the ring look full (producer) or empty (consumer). try_push* may be called
+// only by the producer and try_pop*/front only by the consumer
+template<class T, size_t Capacity>
+class spsc_queue
+{
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "spsc_queue capacity must be a power of two");
+
+public:
+	using value_type = T;
+	using size_type = size_t;
+	using reference = value_type & ;
+	using const_reference = const value_type&;
+
+	spsc_queue() noexcept;
+	spsc_queue(const spsc_queue&) = delete;
+	spsc_queue& operator=(const spsc_queue&) = delete;
+	~spsc_queue();
+
+	// Capacity; empty and size are exact only when both sides are idle
+	static constexpr size_type capacity() noexcept;
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+
+	// Producer side; return false when the queue is full
+	bool try_push(const value_type& value);
+	bool try_push(value_type&& value);
+	template<class... Args>
+	bool try_emplace(Args&&... args);
+	// Copies up to count elements from first and returns how many were pushed
+	template<class InputIt>
+	size_type try_push_n(InputIt first, size_type count);
+
+	// Consumer side; return false when the queue is empty
+	bool try_pop(value_type& value);
+	// Moves up to count elements to out and returns how many were popped
+	template<class OutputIt>
+	size_type try_pop_n(OutputIt out, size_type count);
+	// Oldest element, or nullptr when the queue is empty
+	value_type* front() noexcept;
+
+private:
+	using slot_type = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+	value_type* slot(size_type index) noexcept;
+	// Slots known to be free or filled, rereading the remote index only when
+	// the cached one shows fewer than wanted
+	size_type freeSlots(size_type tail, size_type wanted) noexcept;
+	size_type usedSlots(size_type head, size_type wanted) noexcept;
+
+	// Consumer line: next slot to pop and the last tail seen
+	alignas(BLK_CACHE_LINE_SIZE) std::atomic<size_type> m_head;
+	size_type m_cachedTail;
+	// Producer line: next slot to push and the last head seen
+	alignas(BLK_CACHE_LINE_SIZE) std::atomic<size_type> m_tail;
+	size_type m_cachedHead;
+	alignas(BLK_CACHE_LINE_SIZE) slot_type m_slots[Capacity];
+};
+
+}
+
+#include "../src/spsc_queue.cpp"
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdexcept>
+#include "small_list.h"
+
+namespace blk
+{
+// Overflow policies for static_list
+struct throw_on_overflow
+{
+	static void overflow();
+};
+
+struct terminate_on_overflow
+{
+	static void overflow() noexcept;
+};
+
+// Upstream of a static_list arena: never allocates, reports overflow instead
+template<class T, class OverflowPolicy>
+class StaticListOverflowAllocator
+{
+public:
+	using value_type = T;
+
+	StaticListOverflowAllocator() = default;
+	template<class U>
+	StaticListOverflowAllocator(const StaticListOverflowAllocator<U, OverflowPolicy>& other);
+
+	T* allocate(size_t cnt);
+	void deallocate(T* ptr, size_t cnt);
+};
+
+template<class T, class U, class OverflowPolicy>
+bool operator==(const StaticListOverflowAllocator<T, OverflowPolicy>& left, const StaticListOverflowAllocator<U, OverflowPolicy>& right);
+template<class T, class U, class OverflowPolicy>
+bool operator!=(const StaticListOverflowAllocator<T, OverflowPolicy>& left, const StaticListOverflowAllocator<U, OverflowPolicy>& right);
+
+// List holding at most N elements in in-object storage, never allocating
+template<class T, size_t N, class OverflowPolicy = throw_on_overflow>
+class static_list : public small_list<T, N, StaticListOverflowAllocator<T, OverflowPolicy>>
+{
+	using base_type = small_list<T, N, StaticListOverflowAllocator<T, OverflowPolicy>>;
+
+public:
+	using typename base_type::value_type;
+	using typename base_type::size_type;
+	using typename base_type::iterator;
+	using typename base_type::const_iterator;
+
+	// Constructors
+	static_list() = default;
+	explicit static_list(size_type count, const value_type& value);
+	explicit static_list(size_type count);
+	template<class InputIt, typename Enabled = IsInputIterator<InputIt>>
+	static_list(InputIt first, InputIt last);
+	static_list(const static_list& other) = default;
+	static_list(static_list&& other) = default;
+	static_list(std::initializer_list<T> init);
+
+	// Assignments
+	static_list& operator=(const static_list& other) = default;
+	static_list& operator=(static_list&& other) = default;
+	static_list& operator=(std::initializer_list<T> init);
+
+	// Capacity
+	static constexpr size_type capacity() noexcept;
+	static constexpr size_type max_size() noexcept;
+	bool full() const noexcept;
+
+	// Modifiers reporting overflow through the return value
+	template<class... Args>
+	iterator try_emplace(const_iterator pos, Args&&... args);
+	bool try_push_back(const value_type& value);
+	bool try_push_back(value_type&& value);
+	bool try_push_front(const value_type& value);
+	bool try_push_front(value_type&& value);
+
+	// Extracted nodes would need upstream storage, which a static_list lacks
+	typename base_type::node_type extract(const_iterator pos) = delete;
+	typename base_type::upstream_node_type extract_upstream(const_iterator pos) = delete;
+	// These allocate bookkeeping on the heap
+	template<class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>>
+	void unique_all(Hash hash = Hash(), KeyEqual equal = KeyEqual()) = delete;
+	template<class KeyFn>
+	void sort_by_key(KeyFn key) = delete;
+	std::vector<base_type> split_into(size_type k) = delete;
+};
+
+}
+
+#include "../src/static_list.cpp"
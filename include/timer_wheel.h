@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "list.h"
+
+namespace blk
+{
+template<class Payload, class Allocator>
+class timer_wheel;
+
+// Scheduled timer; the list node that holds it moves between the wheel's
+// buckets and finally into the caller's list of expired timers
+template<class Payload>
+struct TimerWheelEntry
+{
+	template<class... Args>
+	TimerWheelEntry(std::uint64_t due, size_t bucket, Args&&... args);
+
+	// Tick the timer fires at
+	std::uint64_t deadline() const noexcept;
+
+	Payload payload;
+
+private:
+	template<class, class>
+	friend class timer_wheel;
+
+	std::uint64_t due;
+	size_t bucket;
+};
+
+// Hierarchical timer wheel: four levels of 256 buckets, each bucket a list,
+// cover deadlines up to 2^32 ticks ahead (later ones are re-filed as the wheel
+// turns). Scheduling, rescheduling and cancelling relink a single node in
+// O(1); a tick moves a whole higher level bucket out with one splice and
+// re-files its nodes, and hands every due timer over with one splice
+template<class Payload, class Allocator = std::allocator<Payload>>
+class timer_wheel
+{
+public:
+	using entry_type = TimerWheelEntry<Payload>;
+	using allocator_type = Allocator;
+	using size_type = size_t;
+	using tick_type = std::uint64_t;
+
+private:
+	using entry_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<entry_type>;
+
+public:
+	using list_type = list<entry_type, entry_allocator_type>;
+	// Valid until the timer expires or is cancelled
+	using handle = typename list_type::iterator;
+
+	static const size_type levels = 4;
+	static const size_type slotBits = 8;
+	static const size_type slots = size_type(1) << slotBits;
+
+	// Constructors
+	explicit timer_wheel(const Allocator& alloc = Allocator());
+	explicit timer_wheel(tick_type start, const Allocator& alloc = Allocator());
+	timer_wheel(const timer_wheel& other) = delete;
+	timer_wheel(timer_wheel&& other) = default;
+	timer_wheel& operator=(const timer_wheel& other) = delete;
+	allocator_type get_allocator() const;
+
+	// Capacity
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	tick_type now() const noexcept;
+
+	// Timers fire on the tick `delay` ticks from now; a delay of 0 counts as 1
+	handle schedule(tick_type delay, const Payload& payload);
+	handle schedule(tick_type delay, Payload&& payload);
+	template<class... Args>
+	handle emplace(tick_type delay, Args&&... args);
+	void reschedule(handle timer, tick_type delay);
+	void cancel(handle timer);
+	void clear() noexcept;
+
+	// Advances the wheel and appends the timers that fell due to expired, in
+	// deadline order; returns their number. Stretches without due timers or
+	// cascades are skipped in one step
+	size_type advance(tick_type ticks, list_type& expired);
+
+private:
+	static tick_type levelMask(size_type level);
+
+	size_type bucketFor(tick_type due) const;
+	void file(handle timer, list_type& from, list_type& expired);
+	void cascade(size_type level, list_type& expired);
+
+	std::vector<list_type> m_buckets;
+	size_type m_levelSize[levels];
+	list_type m_cascade;
+	size_type m_size;
+	tick_type m_now;
+};
+
+}
+
+#include "../src/timer_wheel.cpp"
@@ -0,0 +1,212 @@
+#include "../include/channel.h"
+
+namespace blk
+{
+
+// channel implementation
+
+template<class T, class Allocator>
+channel<T, Allocator>::channel(size_type capacity, const Allocator& alloc) :
+	m_alloc(alloc),
+	m_capacity(capacity),
+	m_closed(false),
+	m_items(alloc) {}
+
+template<class T, class Allocator>
+typename channel<T, Allocator>::allocator_type channel<T, Allocator>::get_allocator() const
+{
+	return m_alloc;
+}
+
+template<class T, class Allocator>
+typename channel<T, Allocator>::size_type channel<T, Allocator>::capacity() const noexcept
+{
+	return m_capacity;
+}
+
+template<class T, class Allocator>
+typename channel<T, Allocator>::size_type channel<T, Allocator>::size() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_items.size();
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::empty() const
+{
+	return size() == 0;
+}
+
+template<class T, class Allocator>
+void channel<T, Allocator>::close()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_closed = true;
+	}
+	m_notEmpty.notify_all();
+	m_notFull.notify_all();
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::closed() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_closed;
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::push(const value_type& value)
+{
+	return emplace(value);
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::push(value_type&& value)
+{
+	list_type node(m_alloc);
+	node.push_back(std::move(value));
+	if (pushNodes(node, true))
+		return true;
+	value = std::move(node.front());
+	return false;
+}
+
+template<class T, class Allocator>
+template<class... Args>
+bool channel<T, Allocator>::emplace(Args&&... args)
+{
+	list_type node(m_alloc);
+	node.emplace_back(std::forward<Args>(args)...);
+	return pushNodes(node, true);
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::try_push(const value_type& value)
+{
+	list_type node(m_alloc);
+	node.push_back(value);
+	return pushNodes(node, false);
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::try_push(value_type&& value)
+{
+	list_type node(m_alloc);
+	node.push_back(std::move(value));
+	if (pushNodes(node, false))
+		return true;
+	value = std::move(node.front());
+	return false;
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::push_all(list_type& batch)
+{
+	return batch.empty() || pushNodes(batch, true);
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::push_all(list_type&& batch)
+{
+	return push_all(batch);
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::pop(value_type& value)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_notEmpty.wait(lock, [this] { return m_closed || !m_items.empty(); });
+	if (m_items.empty())
+		return false;
+	// The node is released after unlocking
+	list_type node(m_alloc);
+	node.splice(node.end(), m_items, m_items.begin());
+	lock.unlock();
+	notifyRoom();
+	value = std::move(node.front());
+	return true;
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::try_pop(value_type& value)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (m_items.empty())
+		return false;
+	list_type node(m_alloc);
+	node.splice(node.end(), m_items, m_items.begin());
+	lock.unlock();
+	notifyRoom();
+	value = std::move(node.front());
+	return true;
+}
+
+template<class T, class Allocator>
+typename channel<T, Allocator>::size_type channel<T, Allocator>::drain(list_type& out)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_notEmpty.wait(lock, [this] { return m_closed || !m_items.empty(); });
+	size_type count = takeAll(out);
+	lock.unlock();
+	if (count != 0)
+		notifyRoom();
+	return count;
+}
+
+template<class T, class Allocator>
+typename channel<T, Allocator>::size_type channel<T, Allocator>::try_drain(list_type& out)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	size_type count = takeAll(out);
+	lock.unlock();
+	if (count != 0)
+		notifyRoom();
+	return count;
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::hasRoom(size_type count) const
+{
+	return m_capacity == 0 || m_items.size() + count <= m_capacity || (count > m_capacity && m_items.empty());
+}
+
+template<class T, class Allocator>
+bool channel<T, Allocator>::pushNodes(list_type& nodes, bool wait)
+{
+	size_type count = nodes.size();
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if (wait)
+			m_notFull.wait(lock, [this, count] { return m_closed || hasRoom(count); });
+		if (m_closed || !hasRoom(count))
+			return false;
+		m_items.splice(m_items.end(), nodes);
+	}
+	if (count == 1)
+		m_notEmpty.notify_one();
+	else
+		m_notEmpty.notify_all();
+	return true;
+}
+
+template<class T, class Allocator>
+void channel<T, Allocator>::notifyRoom()
+{
+	// Waiting producers may need different amounts of room, so all of them
+	// recheck; unbounded channels have no waiting producers
+	if (m_capacity != 0)
+		m_notFull.notify_all();
+}
+
+template<class T, class Allocator>
+typename channel<T, Allocator>::size_type channel<T, Allocator>::takeAll(list_type& out)
+{
+	size_type count = m_items.size();
+	if (count == 0)
+		return 0;
+	out.splice(out.end(), m_items);
+	return count;
+}
+
+}
@@ -0,0 +1,830 @@
+#include "../include/deque.h"
+
+namespace blk
+{
+
+// DequeIterator implementation
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst>::DequeIterator() : m_map(nullptr), m_index(0) {}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst>::DequeIterator(const DequeIterator<value_type, false>& it) : m_map(it.getMap()), m_index(it.getIndex()) {}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst>::DequeIterator(T* const* map, size_t index) : m_map(map), m_index(index) {}
+
+template<class T, bool IsConst>
+template<bool B>
+bool DequeIterator<T, IsConst>::operator==(const DequeIterator<value_type, B>& it) const
+{
+	return m_index == it.getIndex();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool DequeIterator<T, IsConst>::operator!=(const DequeIterator<value_type, B>& it) const
+{
+	return m_index != it.getIndex();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool DequeIterator<T, IsConst>::operator<(const DequeIterator<value_type, B>& it) const
+{
+	return m_index < it.getIndex();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool DequeIterator<T, IsConst>::operator<=(const DequeIterator<value_type, B>& it) const
+{
+	return m_index <= it.getIndex();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool DequeIterator<T, IsConst>::operator>(const DequeIterator<value_type, B>& it) const
+{
+	return m_index > it.getIndex();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool DequeIterator<T, IsConst>::operator>=(const DequeIterator<value_type, B>& it) const
+{
+	return m_index >= it.getIndex();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+typename DequeIterator<T, IsConst>::difference_type DequeIterator<T, IsConst>::operator-(const DequeIterator<value_type, B>& it) const
+{
+	return static_cast<difference_type>(m_index) - static_cast<difference_type>(it.getIndex());
+}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst>& DequeIterator<T, IsConst>::operator++()
+{
+	m_index++;
+	return *this;
+}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst>& DequeIterator<T, IsConst>::operator--()
+{
+	m_index--;
+	return *this;
+}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst> DequeIterator<T, IsConst>::operator++(int)
+{
+	DequeIterator res(*this);
+	m_index++;
+	return res;
+}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst> DequeIterator<T, IsConst>::operator--(int)
+{
+	DequeIterator res(*this);
+	m_index--;
+	return res;
+}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst>& DequeIterator<T, IsConst>::operator+=(difference_type n)
+{
+	m_index += n;
+	return *this;
+}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst>& DequeIterator<T, IsConst>::operator-=(difference_type n)
+{
+	m_index -= n;
+	return *this;
+}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst> DequeIterator<T, IsConst>::operator+(difference_type n) const
+{
+	return DequeIterator(m_map, m_index + n);
+}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst> DequeIterator<T, IsConst>::operator-(difference_type n) const
+{
+	return DequeIterator(m_map, m_index - n);
+}
+
+template<class T, bool IsConst>
+typename DequeIterator<T, IsConst>::reference DequeIterator<T, IsConst>::operator*() const
+{
+	return m_map[m_index / DequeBlock<T>::size][m_index % DequeBlock<T>::size];
+}
+
+template<class T, bool IsConst>
+typename DequeIterator<T, IsConst>::pointer DequeIterator<T, IsConst>::operator->() const
+{
+	return &**this;
+}
+
+template<class T, bool IsConst>
+typename DequeIterator<T, IsConst>::reference DequeIterator<T, IsConst>::operator[](difference_type n) const
+{
+	return *(*this + n);
+}
+
+template<class T, bool IsConst>
+T* const* DequeIterator<T, IsConst>::getMap() const
+{
+	return m_map;
+}
+
+template<class T, bool IsConst>
+size_t DequeIterator<T, IsConst>::getIndex() const
+{
+	return m_index;
+}
+
+template<class T, bool IsConst>
+DequeIterator<T, IsConst> operator+(typename DequeIterator<T, IsConst>::difference_type n, const DequeIterator<T, IsConst>& it)
+{
+	return it + n;
+}
+
+// deque implementation
+
+template<class T, class Allocator>
+deque<T, Allocator>::deque() :
+	deque(Allocator()) {}
+
+template<class T, class Allocator>
+deque<T, Allocator>::deque(const Allocator& alloc) :
+	m_alloc(alloc),
+	m_map(nullptr),
+	m_mapSize(0),
+	m_start(0),
+	m_size(0),
+	m_spare(nullptr) {}
+
+template<class T, class Allocator>
+deque<T, Allocator>::deque(size_type count, const value_type& value, const Allocator& alloc) :
+	deque(alloc)
+{
+	while (count > 0)
+	{
+		push_back(value);
+		count--;
+	}
+}
+
+template<class T, class Allocator>
+deque<T, Allocator>::deque(size_type count, const Allocator& alloc) :
+	deque(alloc)
+{
+	while (count > 0)
+	{
+		emplace_back();
+		count--;
+	}
+}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+deque<T, Allocator>::deque(InputIt first, InputIt last, const Allocator& alloc) :
+	deque(alloc)
+{
+	for (auto it = first; it != last; ++it)
+		push_back(*it);
+}
+
+template<class T, class Allocator>
+deque<T, Allocator>::deque(const deque& other) :
+	deque(other, std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.get_allocator())) {}
+
+template<class T, class Allocator>
+deque<T, Allocator>::deque(const deque& other, const Allocator& alloc) :
+	deque(other.begin(), other.end(), alloc) {}
+
+template<class T, class Allocator>
+deque<T, Allocator>::deque(deque&& other) noexcept :
+	m_alloc(std::move(other.m_alloc))
+{
+	steal(other);
+}
+
+template<class T, class Allocator>
+deque<T, Allocator>::deque(deque&& other, const Allocator& alloc) :
+	deque(alloc)
+{
+	if (m_alloc == other.m_alloc)
+	{
+		steal(other);
+		return;
+	}
+	for (auto it = other.begin(); it != other.end(); ++it)
+		emplace_back(std::move(*it));
+}
+
+template<class T, class Allocator>
+deque<T, Allocator>::deque(std::initializer_list<T> init, const Allocator& alloc) :
+	deque(init.begin(), init.end(), alloc) {}
+
+template<class T, class Allocator>
+deque<T, Allocator>::~deque()
+{
+	deallocateStorage();
+}
+
+template<class T, class Allocator>
+deque<T, Allocator>& deque<T, Allocator>::operator=(const deque& other)
+{
+	if (this == &other)
+		return *this;
+	if (std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value)
+	{
+		// Storage obtained from the old allocator has to go back to it
+		if (m_alloc != other.m_alloc)
+			deallocateStorage();
+		m_alloc = other.m_alloc;
+	}
+	assign(other.begin(), other.end());
+	return *this;
+}
+
+template<class T, class Allocator>
+deque<T, Allocator>& deque<T, Allocator>::operator=(deque&& other)
+{
+	if (this == &other)
+		return *this;
+	if (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value || m_alloc == other.m_alloc)
+	{
+		deallocateStorage();
+		m_alloc = std::move(other.m_alloc);
+		steal(other);
+	}
+	else
+	{
+		assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+	}
+	return *this;
+}
+
+template<class T, class Allocator>
+deque<T, Allocator>& deque<T, Allocator>::operator=(std::initializer_list<T> init)
+{
+	assign(init);
+	return *this;
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::assign(size_type count, const T& value)
+{
+	clear();
+	while (count > 0)
+	{
+		push_back(value);
+		count--;
+	}
+}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+void deque<T, Allocator>::assign(InputIt first, InputIt last)
+{
+	clear();
+	for (auto it = first; it != last; ++it)
+		push_back(*it);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::assign(std::initializer_list<T> init)
+{
+	assign(init.begin(), init.end());
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::allocator_type deque<T, Allocator>::get_allocator() const
+{
+	return m_alloc;
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::at(size_type pos)
+{
+	if (pos >= m_size)
+		throw std::out_of_range("deque::at");
+	return *slot(m_start + pos);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::at(size_type pos) const
+{
+	if (pos >= m_size)
+		throw std::out_of_range("deque::at");
+	return *slot(m_start + pos);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::operator[](size_type pos)
+{
+	return *slot(m_start + pos);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::operator[](size_type pos) const
+{
+	return *slot(m_start + pos);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::front()
+{
+	return *slot(m_start);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::front() const
+{
+	return *slot(m_start);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::back()
+{
+	return *slot(m_start + m_size - 1);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::back() const
+{
+	return *slot(m_start + m_size - 1);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::begin() noexcept
+{
+	return iterator(m_map, m_start);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_iterator deque<T, Allocator>::begin() const noexcept
+{
+	return const_iterator(m_map, m_start);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_iterator deque<T, Allocator>::cbegin() const noexcept
+{
+	return const_iterator(m_map, m_start);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::end() noexcept
+{
+	return iterator(m_map, m_start + m_size);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_iterator deque<T, Allocator>::end() const noexcept
+{
+	return const_iterator(m_map, m_start + m_size);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_iterator deque<T, Allocator>::cend() const noexcept
+{
+	return const_iterator(m_map, m_start + m_size);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::reverse_iterator deque<T, Allocator>::rbegin() noexcept
+{
+	return reverse_iterator(end());
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::rbegin() const noexcept
+{
+	return const_reverse_iterator(end());
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::crbegin() const noexcept
+{
+	return const_reverse_iterator(cend());
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::reverse_iterator deque<T, Allocator>::rend() noexcept
+{
+	return reverse_iterator(begin());
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::rend() const noexcept
+{
+	return const_reverse_iterator(begin());
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::crend() const noexcept
+{
+	return const_reverse_iterator(cbegin());
+}
+
+template<class T, class Allocator>
+bool deque<T, Allocator>::empty() const noexcept
+{
+	return m_size == 0;
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::size() const noexcept
+{
+	return m_size;
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::max_size() const noexcept
+{
+	return std::allocator_traits<Allocator>::max_size(m_alloc);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::shrink_to_fit()
+{
+	if (m_spare)
+	{
+		std::allocator_traits<Allocator>::deallocate(m_alloc, m_spare, block_size);
+		m_spare = nullptr;
+	}
+	if (m_size == 0)
+		deallocateStorage();
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::clear() noexcept
+{
+	destroyAll();
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(const_iterator pos, const value_type& value)
+{
+	return emplace(pos, value);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(const_iterator pos, value_type&& value)
+{
+	return emplace(pos, std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::emplace(const_iterator pos, Args&&... args)
+{
+	size_type index = pos.getIndex() - m_start;
+	if (index == 0)
+	{
+		emplace_front(std::forward<Args>(args)...);
+		return begin();
+	}
+	if (index == m_size)
+	{
+		emplace_back(std::forward<Args>(args)...);
+		return end() - 1;
+	}
+	value_type value(std::forward<Args>(args)...);
+	if (index < m_size / 2)
+	{
+		// Shift the front part one step towards the front
+		emplace_front(std::move(front()));
+		std::move(begin() + 2, begin() + index + 1, begin() + 1);
+	}
+	else
+	{
+		emplace_back(std::move(back()));
+		std::move_backward(begin() + index, end() - 2, end() - 1);
+	}
+	iterator res = begin() + index;
+	*res = std::move(value);
+	return res;
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::erase(const_iterator pos)
+{
+	return erase(pos, pos + 1);
+}
+
+template<class T, class Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::erase(const_iterator first, const_iterator last)
+{
+	size_type index = first.getIndex() - m_start;
+	size_type count = last.getIndex() - first.getIndex();
+	if (count == 0)
+		return begin() + index;
+	if (index < m_size - index - count)
+	{
+		std::move_backward(begin(), begin() + index, begin() + index + count);
+		for (size_type i = 0; i < count; i++)
+			pop_front();
+	}
+	else
+	{
+		std::move(begin() + index + count, end(), begin() + index);
+		for (size_type i = 0; i < count; i++)
+			pop_back();
+	}
+	return begin() + index;
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::push_back(const value_type& value)
+{
+	emplace_back(value);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::push_back(value_type&& value)
+{
+	emplace_back(std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename deque<T, Allocator>::reference deque<T, Allocator>::emplace_back(Args&&... args)
+{
+	if (!m_map || m_start + m_size == m_mapSize * block_size)
+		reserveMap();
+	size_type index = m_start + m_size;
+	size_type block = index / block_size;
+	bool fresh = m_map[block] == nullptr;
+	if (fresh)
+		m_map[block] = acquireBlock();
+	try
+	{
+		std::allocator_traits<Allocator>::construct(m_alloc, slot(index), std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		if (fresh)
+			releaseBlock(block);
+		throw;
+	}
+	m_size++;
+	return *slot(index);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::push_front(const value_type& value)
+{
+	emplace_front(value);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::push_front(value_type&& value)
+{
+	emplace_front(std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename deque<T, Allocator>::reference deque<T, Allocator>::emplace_front(Args&&... args)
+{
+	if (!m_map || m_start == 0)
+		reserveMap();
+	size_type index = m_start - 1;
+	size_type block = index / block_size;
+	bool fresh = m_map[block] == nullptr;
+	if (fresh)
+		m_map[block] = acquireBlock();
+	try
+	{
+		std::allocator_traits<Allocator>::construct(m_alloc, slot(index), std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		if (fresh)
+			releaseBlock(block);
+		throw;
+	}
+	m_start = index;
+	m_size++;
+	return *slot(index);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::pop_back()
+{
+	size_type index = m_start + m_size - 1;
+	std::allocator_traits<Allocator>::destroy(m_alloc, slot(index));
+	m_size--;
+	if (m_size == 0 || index % block_size == 0)
+		releaseBlock(index / block_size);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::pop_front()
+{
+	size_type index = m_start;
+	std::allocator_traits<Allocator>::destroy(m_alloc, slot(index));
+	m_start++;
+	m_size--;
+	if (m_size == 0 || m_start % block_size == 0)
+		releaseBlock(index / block_size);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::resize(size_type count)
+{
+	while (m_size > count)
+		pop_back();
+	while (m_size < count)
+		emplace_back();
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::resize(size_type count, const value_type& value)
+{
+	while (m_size > count)
+		pop_back();
+	while (m_size < count)
+		push_back(value);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::swap(deque& other)
+{
+	if (std::allocator_traits<Allocator>::propagate_on_container_swap::value)
+		std::swap(m_alloc, other.m_alloc);
+	std::swap(m_map, other.m_map);
+	std::swap(m_mapSize, other.m_mapSize);
+	std::swap(m_start, other.m_start);
+	std::swap(m_size, other.m_size);
+	std::swap(m_spare, other.m_spare);
+}
+
+template<class T, class Allocator>
+T* deque<T, Allocator>::slot(size_type index) const
+{
+	return m_map[index / block_size] + index % block_size;
+}
+
+template<class T, class Allocator>
+T* deque<T, Allocator>::acquireBlock()
+{
+	if (m_spare)
+	{
+		T* res = m_spare;
+		m_spare = nullptr;
+		return res;
+	}
+	return std::allocator_traits<Allocator>::allocate(m_alloc, block_size);
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::releaseBlock(size_type block) noexcept
+{
+	if (m_spare)
+		std::allocator_traits<Allocator>::deallocate(m_alloc, m_map[block], block_size);
+	else
+		m_spare = m_map[block];
+	m_map[block] = nullptr;
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::reserveMap()
+{
+	if (m_size == 0)
+	{
+		// No block is in use, so only the start has to move away from the edge
+		if (!m_map)
+		{
+			map_allocator_type mapAlloc(m_alloc);
+			const size_type initialSize = 8;
+			m_map = std::allocator_traits<map_allocator_type>::allocate(mapAlloc, initialSize);
+			std::fill(m_map, m_map + initialSize, nullptr);
+			m_mapSize = initialSize;
+		}
+		m_start = m_mapSize / 2 * block_size;
+		return;
+	}
+
+	size_type first = m_start / block_size;
+	size_type last = (m_start + m_size - 1) / block_size;
+	size_type used = last - first + 1;
+	size_type newFirst;
+	if (m_mapSize >= 2 * (used + 1))
+	{
+		// Plenty of room left in the map: re-center the blocks in place
+		newFirst = (m_mapSize - used) / 2;
+		if (newFirst < first)
+		{
+			std::copy(m_map + first, m_map + last + 1, m_map + newFirst);
+			std::fill(m_map + std::max(newFirst + used, first), m_map + last + 1, nullptr);
+		}
+		else if (newFirst > first)
+		{
+			std::copy_backward(m_map + first, m_map + last + 1, m_map + newFirst + used);
+			std::fill(m_map + first, m_map + std::min(newFirst, last + 1), nullptr);
+		}
+	}
+	else
+	{
+		map_allocator_type mapAlloc(m_alloc);
+		size_type newSize = std::max(2 * m_mapSize, 2 * (used + 1));
+		block_pointer* map = std::allocator_traits<map_allocator_type>::allocate(mapAlloc, newSize);
+		std::fill(map, map + newSize, nullptr);
+		newFirst = (newSize - used) / 2;
+		std::copy(m_map + first, m_map + last + 1, map + newFirst);
+		std::allocator_traits<map_allocator_type>::deallocate(mapAlloc, m_map, m_mapSize);
+		m_map = map;
+		m_mapSize = newSize;
+	}
+	m_start = newFirst * block_size + m_start % block_size;
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::destroyAll() noexcept
+{
+	if (m_size == 0)
+		return;
+	size_type first = m_start / block_size;
+	size_type last = (m_start + m_size - 1) / block_size;
+	for (size_type i = m_start; i < m_start + m_size; i++)
+		std::allocator_traits<Allocator>::destroy(m_alloc, slot(i));
+	for (size_type block = first; block <= last; block++)
+		releaseBlock(block);
+	m_size = 0;
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::deallocateStorage() noexcept
+{
+	destroyAll();
+	if (m_spare)
+	{
+		std::allocator_traits<Allocator>::deallocate(m_alloc, m_spare, block_size);
+		m_spare = nullptr;
+	}
+	if (m_map)
+	{
+		map_allocator_type mapAlloc(m_alloc);
+		std::allocator_traits<map_allocator_type>::deallocate(mapAlloc, m_map, m_mapSize);
+		m_map = nullptr;
+		m_mapSize = 0;
+	}
+	m_start = 0;
+}
+
+template<class T, class Allocator>
+void deque<T, Allocator>::steal(deque& other) noexcept
+{
+	m_map = other.m_map;
+	m_mapSize = other.m_mapSize;
+	m_start = other.m_start;
+	m_size = other.m_size;
+	m_spare = other.m_spare;
+	other.m_map = nullptr;
+	other.m_mapSize = 0;
+	other.m_start = 0;
+	other.m_size = 0;
+	other.m_spare = nullptr;
+}
+
+template<class T, class Allocator>
+bool operator==(const deque<T, Allocator>& left, const deque<T, Allocator>& right)
+{
+	return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin());
+}
+
+template<class T, class Allocator>
+bool operator!=(const deque<T, Allocator>& left, const deque<T, Allocator>& right)
+{
+	return !(left == right);
+}
+
+template<class T, class Allocator>
+bool operator<(const deque<T, Allocator>& left, const deque<T, Allocator>& right)
+{
+	return std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end());
+}
+
+}
+
+namespace std
+{
+
+template<class T, class Allocator>
+void swap(blk::deque<T, Allocator>& left, blk::deque<T, Allocator>& right)
+{
+	left.swap(right);
+}
+
+}
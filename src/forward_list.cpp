@@ -0,0 +1,694 @@
+#include "../include/forward_list.h"
+
+namespace blk
+{
+
+// ForwardListIterator implementation
+
+template<class T, bool IsConst>
+ForwardListIterator<T, IsConst>::ForwardListIterator() : m_item(nullptr) {}
+
+template<class T, bool IsConst>
+ForwardListIterator<T, IsConst>::ForwardListIterator(const ForwardListIterator<value_type, false>& it) : m_item(it.getNode()) {}
+
+template<class T, bool IsConst>
+ForwardListIterator<T, IsConst>::ForwardListIterator(ForwardListNode<value_type>* node) : m_item(node) {}
+
+template<class T, bool IsConst>
+template<bool B>
+bool ForwardListIterator<T, IsConst>::operator==(const ForwardListIterator<value_type, B>& it) const
+{
+	return m_item == it.getNode();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool ForwardListIterator<T, IsConst>::operator!=(const ForwardListIterator<value_type, B>& it) const
+{
+	return !(*this == it);
+}
+
+template<class T, bool IsConst>
+ForwardListIterator<T, IsConst>& ForwardListIterator<T, IsConst>::operator++()
+{
+	m_item = m_item->next;
+	return *this;
+}
+
+template<class T, bool IsConst>
+ForwardListIterator<T, IsConst> ForwardListIterator<T, IsConst>::operator++(int)
+{
+	ForwardListIterator res = *this;
+	this->operator++();
+	return res;
+}
+
+template<class T, bool IsConst>
+typename ForwardListIterator<T, IsConst>::reference ForwardListIterator<T, IsConst>::operator*() const
+{
+	return m_item->val;
+}
+
+template<class T, bool IsConst>
+typename ForwardListIterator<T, IsConst>::pointer ForwardListIterator<T, IsConst>::operator->() const
+{
+	return &m_item->val;
+}
+
+template<class T, bool IsConst>
+ForwardListNode<typename ForwardListIterator<T, IsConst>::value_type> * ForwardListIterator<T, IsConst>::getNode() const
+{
+	return m_item;
+}
+
+// forward_list implementation
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::forward_list() :
+	forward_list(Allocator()) {}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::forward_list(const Allocator& alloc) :
+	m_alloc(alloc),
+	m_headNode(allocateHeadNode()) {}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::forward_list(size_type count, const value_type& value, const Allocator& alloc) :
+	forward_list(alloc)
+{
+	insert_after(before_begin(), count, value);
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::forward_list(size_type count, const Allocator& alloc) :
+	forward_list(alloc)
+{
+	resize(count);
+}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+forward_list<T, Allocator>::forward_list(InputIt first, InputIt last, const Allocator& alloc) :
+	forward_list(alloc)
+{
+	insert_after(before_begin(), first, last);
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::forward_list(const forward_list& other) :
+	forward_list(std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.get_allocator()))
+{
+	insert_after(before_begin(), other.begin(), other.end());
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::forward_list(const forward_list& other, const Allocator& alloc) :
+	forward_list(alloc)
+{
+	insert_after(before_begin(), other.begin(), other.end());
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::forward_list(forward_list&& other) :
+	m_alloc(std::move(other.m_alloc)),
+	m_headNode(other.m_headNode)
+{
+	other.m_headNode = nullptr;
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::forward_list(forward_list&& other, const Allocator& alloc) :
+	forward_list(alloc)
+{
+	splice_after(before_begin(), other);
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::forward_list(std::initializer_list<T> init, const Allocator& alloc) :
+	forward_list(alloc)
+{
+	insert_after(before_begin(), init.begin(), init.end());
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>::~forward_list()
+{
+	if (m_headNode)
+	{
+		node_allocator_type nodeAlloc(m_alloc);
+		clear();
+		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, m_headNode, 1);
+		m_headNode = nullptr;
+	}
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>& forward_list<T, Allocator>::operator=(const forward_list& other)
+{
+	if (this != &other)
+		assign(other.begin(), other.end());
+	return *this;
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>& forward_list<T, Allocator>::operator=(forward_list&& other)
+{
+	if (this != &other)
+	{
+		clear();
+		splice_after(before_begin(), other);
+	}
+	return *this;
+}
+
+template<class T, class Allocator>
+forward_list<T, Allocator>& forward_list<T, Allocator>::operator=(std::initializer_list<T> init)
+{
+	assign(init);
+	return *this;
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::assign(size_type count, const T& value)
+{
+	clear();
+	insert_after(before_begin(), count, value);
+}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+void forward_list<T, Allocator>::assign(InputIt first, InputIt last)
+{
+	clear();
+	insert_after(before_begin(), first, last);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::assign(std::initializer_list<T> init)
+{
+	clear();
+	insert_after(before_begin(), init);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::allocator_type forward_list<T, Allocator>::get_allocator() const
+{
+	return m_alloc;
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::reference forward_list<T, Allocator>::front()
+{
+	return m_headNode->next->val;
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::const_reference forward_list<T, Allocator>::front() const
+{
+	return m_headNode->next->val;
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::before_begin() noexcept
+{
+	return iterator(m_headNode);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::before_begin() const noexcept
+{
+	return const_iterator(m_headNode);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::cbefore_begin() const noexcept
+{
+	return const_iterator(m_headNode);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::begin() noexcept
+{
+	return iterator(m_headNode->next);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::begin() const noexcept
+{
+	return const_iterator(m_headNode->next);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::cbegin() const noexcept
+{
+	return const_iterator(m_headNode->next);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::end() noexcept
+{
+	return iterator(nullptr);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::end() const noexcept
+{
+	return const_iterator(nullptr);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::cend() const noexcept
+{
+	return const_iterator(nullptr);
+}
+
+template<class T, class Allocator>
+bool forward_list<T, Allocator>::empty() const noexcept
+{
+	return m_headNode->next == nullptr;
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::size_type forward_list<T, Allocator>::max_size() const noexcept
+{
+	return std::numeric_limits<size_type>::max();
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::clear() noexcept
+{
+	node_type *node = m_headNode->next;
+	while (node != nullptr)
+		node = destroyNode(node);
+	m_headNode->next = nullptr;
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert_after(const_iterator pos, const value_type& value)
+{
+	return emplace_after(pos, value);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert_after(const_iterator pos, value_type&& value)
+{
+	return emplace_after(pos, std::move(value));
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert_after(const_iterator pos, size_type count, const value_type& value)
+{
+	iterator res(pos.getNode());
+	while (count > 0)
+	{
+		res = emplace_after(res, value);
+		count--;
+	}
+	return res;
+}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert_after(const_iterator pos, InputIt first, InputIt last)
+{
+	iterator res(pos.getNode());
+	for (auto it = first; it != last; ++it)
+		res = emplace_after(res, *it);
+	return res;
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert_after(const_iterator pos, std::initializer_list<T> init)
+{
+	return insert_after(pos, init.begin(), init.end());
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::emplace_after(const_iterator pos, Args&&... args)
+{
+	node_type *posNode = pos.getNode();
+	node_type *node = allocateNode(posNode->next);
+	try
+	{
+		std::allocator_traits<Allocator>::construct(m_alloc, &node->val, std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		node_allocator_type nodeAlloc(m_alloc);
+		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
+		throw;
+	}
+	posNode->next = node;
+	return iterator(node);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::erase_after(const_iterator pos)
+{
+	node_type *posNode = pos.getNode();
+	posNode->next = destroyNode(posNode->next);
+	return iterator(posNode->next);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::erase_after(const_iterator first, const_iterator last)
+{
+	node_type *node = first.getNode()->next;
+	while (node != last.getNode())
+		node = destroyNode(node);
+	first.getNode()->next = last.getNode();
+	return iterator(last.getNode());
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::push_front(const value_type& value)
+{
+	emplace_after(before_begin(), value);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::push_front(value_type&& value)
+{
+	emplace_after(before_begin(), std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename forward_list<T, Allocator>::reference forward_list<T, Allocator>::emplace_front(Args&&... args)
+{
+	return *emplace_after(before_begin(), std::forward<Args>(args)...);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::pop_front()
+{
+	erase_after(before_begin());
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::resize(size_type count)
+{
+	iterator last = before_begin();
+	for (; count > 0 && last.getNode()->next != nullptr; count--)
+		++last;
+	if (count == 0)
+	{
+		erase_after(last, end());
+		return;
+	}
+	for (; count > 0; count--)
+		last = emplace_after(last);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::resize(size_type count, const value_type& value)
+{
+	iterator last = before_begin();
+	for (; count > 0 && last.getNode()->next != nullptr; count--)
+		++last;
+	if (count == 0)
+		erase_after(last, end());
+	else
+		insert_after(last, count, value);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::swap(forward_list& other)
+{
+	std::swap(m_alloc, other.m_alloc);
+	std::swap(m_headNode, other.m_headNode);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::merge(forward_list& other)
+{
+	merge(other, [](const T& left, const T& right) { return left < right; });
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::merge(forward_list&& other)
+{
+	merge(other);
+}
+
+template<class T, class Allocator>
+template <class Compare>
+void forward_list<T, Allocator>::merge(forward_list& other, Compare comp)
+{
+	if (this == &other)
+		return;
+	if (!ListNodeTransfer<Allocator>::canRelinkAll(m_alloc, other.m_alloc))
+	{
+		forward_list moved(m_alloc);
+		moved.splice_after(moved.before_begin(), other);
+		merge(moved, comp);
+		return;
+	}
+	m_headNode->next = mergeChains(m_headNode->next, other.m_headNode->next, comp);
+	other.m_headNode->next = nullptr;
+}
+
+template<class T, class Allocator>
+template <class Compare>
+void forward_list<T, Allocator>::merge(forward_list&& other, Compare comp)
+{
+	merge(other, comp);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::splice_after(const_iterator pos, forward_list& other)
+{
+	commonSplice(pos, other, other.before_begin(), other.end());
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::splice_after(const_iterator pos, forward_list&& other)
+{
+	commonSplice(pos, other, other.before_begin(), other.end());
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::splice_after(const_iterator pos, forward_list& other, const_iterator it)
+{
+	const_iterator next = it;
+	++next;
+	if (pos == it || pos == next)
+		return;
+	commonSplice(pos, other, it, ++next);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::splice_after(const_iterator pos, forward_list&& other, const_iterator it)
+{
+	splice_after(pos, other, it);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::splice_after(const_iterator pos, forward_list& other, const_iterator first, const_iterator last)
+{
+	commonSplice(pos, other, first, last);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::splice_after(const_iterator pos, forward_list&& other, const_iterator first, const_iterator last)
+{
+	commonSplice(pos, other, first, last);
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::remove(const value_type& value)
+{
+	remove_if([&value](const value_type& v) { return value == v; });
+}
+
+template<class T, class Allocator>
+template<class UnaryPredicate>
+void forward_list<T, Allocator>::remove_if(UnaryPredicate p)
+{
+	node_type *prev = m_headNode;
+	ListPrefetcher<node_type> ahead(prev->next, nullptr);
+	while (prev->next != nullptr)
+	{
+		ahead.advance();
+		if (p(prev->next->val))
+			prev->next = destroyNode(prev->next);
+		else
+			prev = prev->next;
+	}
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::reverse() noexcept
+{
+	node_type *reversed = nullptr;
+	node_type *node = m_headNode->next;
+	while (node != nullptr)
+	{
+		node_type *next = node->next;
+		node->next = reversed;
+		reversed = node;
+		node = next;
+	}
+	m_headNode->next = reversed;
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::unique()
+{
+	unique([](const T& left, const T& right) { return left == right; });
+}
+
+template<class T, class Allocator>
+template<class BinaryPredicate>
+void forward_list<T, Allocator>::unique(BinaryPredicate p)
+{
+	node_type *kept = m_headNode->next;
+	if (kept == nullptr)
+		return;
+	while (kept->next != nullptr)
+	{
+		if (p(kept->val, kept->next->val))
+			kept->next = destroyNode(kept->next);
+		else
+			kept = kept->next;
+	}
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::sort()
+{
+	sort([](const T& left, const T& right) { return left < right; });
+}
+
+template<class T, class Allocator>
+template<class Compare>
+void forward_list<T, Allocator>::sort(Compare comp)
+{
+	size_type size = 0;
+	for (node_type *node = m_headNode->next; node != nullptr; node = node->next)
+		size++;
+	m_headNode->next = sortChain(m_headNode->next, size, comp);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::node_type* forward_list<T, Allocator>::allocateNode(node_type* next)
+{
+	node_allocator_type nodeAlloc(m_alloc);
+	node_type *res = std::allocator_traits<node_allocator_type>::allocate(nodeAlloc, 1);
+	res->next = next;
+	return res;
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::node_type* forward_list<T, Allocator>::allocateHeadNode()
+{
+	return allocateNode(nullptr);
+}
+
+template<class T, class Allocator>
+typename forward_list<T, Allocator>::node_type* forward_list<T, Allocator>::destroyNode(node_type* node)
+{
+	node_allocator_type nodeAlloc(m_alloc);
+	std::allocator_traits<Allocator>::destroy(m_alloc, &node->val);
+	node_type *res = node->next;
+	std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
+	return res;
+}
+
+template<class T, class Allocator>
+void forward_list<T, Allocator>::commonSplice(const_iterator pos, forward_list& other, const_iterator first, const_iterator last)
+{
+	node_type *firstNode = first.getNode();
+	node_type *lastNode = last.getNode();
+	if (firstNode->next == lastNode)
+		return;
+	if (!ListNodeTransfer<Allocator>::canRelinkAll(m_alloc, other.m_alloc))
+	{
+		const_iterator to = pos;
+		for (node_type *node = firstNode->next; node != lastNode; node = node->next)
+			to = emplace_after(to, std::move(node->val));
+		other.erase_after(first, last);
+		return;
+	}
+
+	node_type *tailNode = firstNode->next;
+	while (tailNode->next != lastNode)
+		tailNode = tailNode->next;
+	node_type *posNode = pos.getNode();
+	// The range already follows pos
+	if (this == &other && (posNode == firstNode || posNode == tailNode))
+		return;
+	tailNode->next = posNode->next;
+	posNode->next = firstNode->next;
+	firstNode->next = lastNode;
+}
+
+template<class T, class Allocator>
+bool operator==(const forward_list<T, Allocator>& left, const forward_list<T, Allocator>& right)
+{
+	auto itLeft = left.begin();
+	auto itRight = right.begin();
+	while (itLeft != left.end() && itRight != right.end())
+	{
+		if (*itLeft != *itRight)
+			return false;
+		++itLeft;
+		++itRight;
+	}
+	return itLeft == left.end() && itRight == right.end();
+}
+
+template<class T, class Allocator>
+bool operator!=(const forward_list<T, Allocator>& left, const forward_list<T, Allocator>& right)
+{
+	return !(left == right);
+}
+
+template<class T, class Allocator>
+bool operator<(const forward_list<T, Allocator>& left, const forward_list<T, Allocator>& right)
+{
+	auto itLeft = left.begin();
+	auto itRight = right.begin();
+	while (itLeft != left.end() && itRight != right.end())
+	{
+		if (*itLeft < *itRight)
+			return true;
+		if (*itRight < *itLeft)
+			return false;
+		++itLeft;
+		++itRight;
+	}
+	return itLeft == left.end() && itRight != right.end();
+}
+
+template<class T, class Allocator>
+bool operator<=(const forward_list<T, Allocator>& left, const forward_list<T, Allocator>& right)
+{
+	return !(right < left);
+}
+
+template<class T, class Allocator>
+bool operator>(const forward_list<T, Allocator>& left, const forward_list<T, Allocator>& right)
+{
+	return right < left;
+}
+
+template<class T, class Allocator>
+bool operator>=(const forward_list<T, Allocator>& left, const forward_list<T, Allocator>& right)
+{
+	return !(left < right);
+}
+
+}
+
+namespace std
+{
+
+template<class T, class Allocator>
+void swap(blk::forward_list<T, Allocator>& left, blk::forward_list<T, Allocator>& right)
+{
+	left.swap(right);
+}
+
+}
@@ -0,0 +1,226 @@
+#include "../include/huge_page_allocator.h"
+
+namespace blk
+{
+
+// HugePageArena implementation
+
+inline HugePageArena::HugePageArena(size_t regionSize) :
+	m_cursor(nullptr),
+	m_end(nullptr),
+	m_regionSize((regionSize + hugePageSize - 1) / hugePageSize * hugePageSize),
+	m_hugePageRegions(0)
+{
+	if (m_regionSize == 0)
+		m_regionSize = hugePageSize;
+}
+
+inline HugePageArena::~HugePageArena()
+{
+	for (char* region : m_regions)
+	{
+#if defined(_WIN32)
+		::_aligned_free(region);
+#else
+		::munmap(region, m_regionSize);
+#endif
+	}
+}
+
+inline void* HugePageArena::allocate(size_t size, size_t align)
+{
+	if (!isSlotRequest(size, align))
+		return allocateLarge(size, align);
+	FreeList& slots = freeList(size, align);
+	if (slots.head)
+	{
+		void* res = slots.head;
+		slots.head = *static_cast<void**>(res);
+		return res;
+	}
+	char* res = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(m_cursor) + slots.align - 1) & ~std::uintptr_t(slots.align - 1));
+	if (!m_cursor || res + slots.size > m_end)
+	{
+		reserveRegion();
+		res = m_cursor;
+	}
+	m_cursor = res + slots.size;
+	return res;
+}
+
+inline void HugePageArena::deallocate(void* ptr, size_t size, size_t align) noexcept
+{
+	if (!isSlotRequest(size, align))
+	{
+		deallocateLarge(ptr, align);
+		return;
+	}
+	// A free list for the size exists since the slot was handed out
+	FreeList& slots = freeList(size, align);
+	*static_cast<void**>(ptr) = slots.head;
+	slots.head = ptr;
+}
+
+inline bool HugePageArena::owns(const void* ptr) const noexcept
+{
+	const char* p = static_cast<const char*>(ptr);
+	for (const char* region : m_regions)
+		if (p >= region && p < region + m_regionSize)
+			return true;
+	return false;
+}
+
+inline size_t HugePageArena::regionSize() const noexcept
+{
+	return m_regionSize;
+}
+
+inline size_t HugePageArena::regionCount() const noexcept
+{
+	return m_regions.size();
+}
+
+inline size_t HugePageArena::hugePageRegions() const noexcept
+{
+	return m_hugePageRegions;
+}
+
+inline bool HugePageArena::isSlotRequest(size_t size, size_t align) noexcept
+{
+	// Slots are carved from huge page aligned regions, so any alignment up
+	// to the slot size limit can be honoured
+	return size <= maxSlotSize && align <= maxSlotSize;
+}
+
+inline void* HugePageArena::allocateLarge(size_t size, size_t align)
+{
+	// operator new only guarantees fundamental alignment before C++17
+	if (align <= alignof(std::max_align_t))
+		return ::operator new(size);
+#if defined(_WIN32)
+	void* res = ::_aligned_malloc(size, align);
+	if (!res)
+		throw std::bad_alloc();
+#else
+	void* res = nullptr;
+	if (::posix_memalign(&res, align < sizeof(void*) ? sizeof(void*) : align, size) != 0)
+		throw std::bad_alloc();
+#endif
+	return res;
+}
+
+inline void HugePageArena::deallocateLarge(void* ptr, size_t align) noexcept
+{
+	if (align <= alignof(std::max_align_t))
+		::operator delete(ptr);
+	else
+#if defined(_WIN32)
+		::_aligned_free(ptr);
+#else
+		::free(ptr);
+#endif
+}
+
+inline size_t HugePageArena::slotAlign(size_t align) noexcept
+{
+	return align < alignof(void*) ? alignof(void*) : align;
+}
+
+inline size_t HugePageArena::slotSize(size_t size, size_t align) noexcept
+{
+	// Every slot must be able to hold the free list link
+	size_t res = size < sizeof(void*) ? sizeof(void*) : size;
+	return (res + align - 1) / align * align;
+}
+
+inline HugePageArena::FreeList& HugePageArena::freeList(size_t size, size_t align)
+{
+	align = slotAlign(align);
+	size = slotSize(size, align);
+	// Only a handful of node types share an arena, so a linear scan is enough
+	for (FreeList& slots : m_freeLists)
+		if (slots.size == size && slots.align == align)
+			return slots;
+	m_freeLists.push_back(FreeList { size, align, nullptr });
+	return m_freeLists.back();
+}
+
+inline void HugePageArena::reserveRegion()
+{
+	m_regions.reserve(m_regions.size() + 1);
+#if defined(_WIN32)
+	// Align to the huge page size so slot alignment matches the mmap branch
+	char* region = static_cast<char*>(::_aligned_malloc(m_regionSize, hugePageSize));
+	if (!region)
+		throw std::bad_alloc();
+#else
+	// Over-reserve by one huge page and trim both ends to get the alignment
+	size_t span = m_regionSize + hugePageSize;
+	void* raw = ::mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (raw == MAP_FAILED)
+		throw std::bad_alloc();
+	char* start = static_cast<char*>(raw);
+	char* region = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(start) + hugePageSize - 1) & ~std::uintptr_t(hugePageSize - 1));
+	if (region != start)
+		::munmap(start, static_cast<size_t>(region - start));
+	size_t tail = static_cast<size_t>(start + span - (region + m_regionSize));
+	if (tail > 0)
+		::munmap(region + m_regionSize, tail);
+#if defined(MADV_HUGEPAGE)
+	if (::madvise(region, m_regionSize, MADV_HUGEPAGE) == 0)
+		m_hugePageRegions++;
+#endif
+#endif
+	m_regions.push_back(region);
+	m_cursor = region;
+	m_end = region + m_regionSize;
+}
+
+// huge_page_allocator implementation
+
+template<class T>
+huge_page_allocator<T>::huge_page_allocator() :
+	m_arena(std::make_shared<HugePageArena>()) {}
+
+template<class T>
+huge_page_allocator<T>::huge_page_allocator(std::shared_ptr<HugePageArena> arena) :
+	m_arena(std::move(arena)) {}
+
+template<class T>
+template<class U>
+huge_page_allocator<T>::huge_page_allocator(const huge_page_allocator<U>& other) :
+	m_arena(other.arena()) {}
+
+template<class T>
+T* huge_page_allocator<T>::allocate(size_t cnt)
+{
+	if (cnt > std::numeric_limits<size_t>::max() / sizeof(T))
+		throw std::bad_array_new_length();
+	return static_cast<T*>(m_arena->allocate(cnt * sizeof(T), alignof(T)));
+}
+
+template<class T>
+void huge_page_allocator<T>::deallocate(T* ptr, size_t cnt) noexcept
+{
+	m_arena->deallocate(ptr, cnt * sizeof(T), alignof(T));
+}
+
+template<class T>
+const std::shared_ptr<HugePageArena>& huge_page_allocator<T>::arena() const noexcept
+{
+	return m_arena;
+}
+
+template<class T, class U>
+bool operator==(const huge_page_allocator<T>& left, const huge_page_allocator<U>& right)
+{
+	return left.arena() == right.arena();
+}
+
+template<class T, class U>
+bool operator!=(const huge_page_allocator<T>& left, const huge_page_allocator<U>& right)
+{
+	return !(left == right);
+}
+
+}
@@ -0,0 +1,1137 @@
+#include <cstdint>
+#include "../include/indexed_list.h"
+
+namespace blk
+{
+
+// IndexedListTree implementation
+
+template<class T>
+size_t IndexedListTree<T>::count(const node_type* node)
+{
+	return node ? node->count : 0;
+}
+
+template<class T>
+void IndexedListTree<T>::update(node_type* node)
+{
+	node->count = 1 + count(node->left) + count(node->right);
+	if (node->left)
+		node->left->parent = node;
+	if (node->right)
+		node->right->parent = node;
+}
+
+template<class T>
+void IndexedListTree<T>::setRoot(node_type* head, node_type* root)
+{
+	head->left = root;
+	if (root)
+		root->parent = head;
+}
+
+template<class T>
+typename IndexedListTree<T>::node_type* IndexedListTree<T>::headOf(node_type* node)
+{
+	while (node->parent)
+		node = node->parent;
+	return node;
+}
+
+template<class T>
+size_t IndexedListTree<T>::indexOf(const node_type* node)
+{
+	size_t res = count(node->left);
+	if (!node->parent)
+		return res;
+	while (node->parent->parent)
+	{
+		const node_type *parent = node->parent;
+		if (parent->right == node)
+			res += count(parent->left) + 1;
+		node = parent;
+	}
+	return res;
+}
+
+template<class T>
+typename IndexedListTree<T>::node_type* IndexedListTree<T>::nth(node_type* head, size_t index)
+{
+	node_type *node = head->left;
+	if (index >= count(node))
+		return head;
+	while (true)
+	{
+		size_t leftCount = count(node->left);
+		if (index < leftCount)
+			node = node->left;
+		else if (index == leftCount)
+			return node;
+		else
+		{
+			index -= leftCount + 1;
+			node = node->right;
+		}
+	}
+}
+
+template<class T>
+void IndexedListTree<T>::split(node_type* node, size_t index, node_type*& left, node_type*& right)
+{
+	if (!node)
+	{
+		left = right = nullptr;
+		return;
+	}
+	if (count(node->left) < index)
+	{
+		split(node->right, index - count(node->left) - 1, node->right, right);
+		left = node;
+	}
+	else
+	{
+		split(node->left, index, left, node->left);
+		right = node;
+	}
+	update(node);
+}
+
+template<class T>
+typename IndexedListTree<T>::node_type* IndexedListTree<T>::merge(node_type* left, node_type* right)
+{
+	if (!left)
+		return right;
+	if (!right)
+		return left;
+	if (left->priority > right->priority)
+	{
+		left->right = merge(left->right, right);
+		update(left);
+		return left;
+	}
+	right->left = merge(left, right->left);
+	update(right);
+	return right;
+}
+
+template<class T>
+void IndexedListTree<T>::erase(node_type* node)
+{
+	node_type *replacement = merge(node->left, node->right);
+	node_type *parent = node->parent;
+	if (parent->left == node)
+		parent->left = replacement;
+	else
+		parent->right = replacement;
+	if (replacement)
+		replacement->parent = parent;
+	for (; parent->parent; parent = parent->parent)
+		parent->count--;
+}
+
+template<class T>
+void IndexedListTree<T>::rebuild(node_type* head)
+{
+	// Cartesian tree over the threaded sequence, keeping node priorities.
+	// The right spine is walked upwards through the parent links, so nothing
+	// is allocated and every node is visited O(1) times amortized
+	node_type *root = nullptr;
+	node_type *last = nullptr;
+	for (node_type *node = head->next; node != head; node = node->next)
+	{
+		node_type *parent = last;
+		node_type *child = nullptr;
+		while (parent && parent->priority < node->priority)
+		{
+			child = parent;
+			parent = parent->parent;
+		}
+		node->left = child;
+		node->right = nullptr;
+		node->parent = parent;
+		if (child)
+			child->parent = node;
+		if (parent)
+			parent->right = node;
+		else
+			root = node;
+		last = node;
+	}
+	recount(root);
+	setRoot(head, root);
+}
+
+template<class T>
+size_t IndexedListTree<T>::recount(node_type* node)
+{
+	if (!node)
+		return 0;
+	recount(node->left);
+	recount(node->right);
+	update(node);
+	return node->count;
+}
+
+// IndexedListIterator implementation
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst>::IndexedListIterator() : m_item(nullptr) {}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst>::IndexedListIterator(const IndexedListIterator<value_type, false>& it) : m_item(it.getNode()) {}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst>::IndexedListIterator(IndexedListNode<value_type>* node) : m_item(node) {}
+
+template<class T, bool IsConst>
+template<bool B>
+bool IndexedListIterator<T, IsConst>::operator==(const IndexedListIterator<value_type, B>& it) const
+{
+	return m_item == it.getNode();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool IndexedListIterator<T, IsConst>::operator!=(const IndexedListIterator<value_type, B>& it) const
+{
+	return !(*this == it);
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool IndexedListIterator<T, IsConst>::operator<(const IndexedListIterator<value_type, B>& it) const
+{
+	return (*this - it) < 0;
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool IndexedListIterator<T, IsConst>::operator>(const IndexedListIterator<value_type, B>& it) const
+{
+	return it < *this;
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool IndexedListIterator<T, IsConst>::operator<=(const IndexedListIterator<value_type, B>& it) const
+{
+	return !(it < *this);
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool IndexedListIterator<T, IsConst>::operator>=(const IndexedListIterator<value_type, B>& it) const
+{
+	return !(*this < it);
+}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst>& IndexedListIterator<T, IsConst>::operator++()
+{
+	m_item = m_item->next;
+	return *this;
+}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst>& IndexedListIterator<T, IsConst>::operator--()
+{
+	m_item = m_item->prev;
+	return *this;
+}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst> IndexedListIterator<T, IsConst>::operator++(int)
+{
+	IndexedListIterator res = *this;
+	this->operator++();
+	return res;
+}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst> IndexedListIterator<T, IsConst>::operator--(int)
+{
+	IndexedListIterator res = *this;
+	this->operator--();
+	return res;
+}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst>& IndexedListIterator<T, IsConst>::operator+=(difference_type n)
+{
+	if (n == 0)
+		return *this;
+	difference_type index = static_cast<difference_type>(IndexedListTree<T>::indexOf(m_item)) + n;
+	m_item = IndexedListTree<T>::nth(IndexedListTree<T>::headOf(m_item), static_cast<size_t>(index));
+	return *this;
+}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst>& IndexedListIterator<T, IsConst>::operator-=(difference_type n)
+{
+	return *this += -n;
+}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst> IndexedListIterator<T, IsConst>::operator+(difference_type n) const
+{
+	IndexedListIterator res = *this;
+	res += n;
+	return res;
+}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst> IndexedListIterator<T, IsConst>::operator-(difference_type n) const
+{
+	IndexedListIterator res = *this;
+	res -= n;
+	return res;
+}
+
+template<class T, bool IsConst>
+template<bool B>
+typename IndexedListIterator<T, IsConst>::difference_type IndexedListIterator<T, IsConst>::operator-(const IndexedListIterator<value_type, B>& it) const
+{
+	return static_cast<difference_type>(IndexedListTree<T>::indexOf(m_item)) - static_cast<difference_type>(IndexedListTree<T>::indexOf(it.getNode()));
+}
+
+template<class T, bool IsConst>
+typename IndexedListIterator<T, IsConst>::reference IndexedListIterator<T, IsConst>::operator*() const
+{
+	return m_item->val;
+}
+
+template<class T, bool IsConst>
+typename IndexedListIterator<T, IsConst>::pointer IndexedListIterator<T, IsConst>::operator->() const
+{
+	return &m_item->val;
+}
+
+template<class T, bool IsConst>
+typename IndexedListIterator<T, IsConst>::reference IndexedListIterator<T, IsConst>::operator[](difference_type n) const
+{
+	return *(*this + n);
+}
+
+template<class T, bool IsConst>
+IndexedListNode<typename IndexedListIterator<T, IsConst>::value_type> * IndexedListIterator<T, IsConst>::getNode() const
+{
+	return m_item;
+}
+
+template<class T, bool IsConst>
+IndexedListIterator<T, IsConst> operator+(typename IndexedListIterator<T, IsConst>::difference_type n, const IndexedListIterator<T, IsConst>& it)
+{
+	return it + n;
+}
+
+// indexed_list implementation
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list() :
+	indexed_list(Allocator()) {}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(const Allocator& alloc) :
+	m_alloc(alloc),
+	m_headNode(allocateHeadNode()),
+	m_size(0),
+	m_seed(static_cast<unsigned>(reinterpret_cast<std::uintptr_t>(this) >> 4) * 2654435761u | 1) {}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(size_type count, const value_type& value, const Allocator& alloc) :
+	indexed_list(alloc)
+{
+	insert(end(), count, value);
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(size_type count, const Allocator& alloc) :
+	indexed_list(alloc)
+{
+	while (count > 0)
+	{
+		emplace_back();
+		count--;
+	}
+}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+indexed_list<T, Allocator>::indexed_list(InputIt first, InputIt last, const Allocator& alloc) :
+	indexed_list(alloc)
+{
+	insert(end(), first, last);
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(const indexed_list& other) :
+	indexed_list(std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.get_allocator()))
+{
+	insert(end(), other.begin(), other.end());
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(const indexed_list& other, const Allocator& alloc) :
+	indexed_list(alloc)
+{
+	insert(end(), other.begin(), other.end());
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(indexed_list&& other) :
+	m_alloc(std::move(other.m_alloc)),
+	m_headNode(other.m_headNode),
+	m_size(other.m_size),
+	m_seed(other.m_seed)
+{
+	other.m_headNode = nullptr;
+	other.m_size = 0;
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(indexed_list&& other, const Allocator& alloc) :
+	indexed_list(alloc)
+{
+	splice(end(), other);
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(std::initializer_list<T> init, const Allocator& alloc) :
+	indexed_list(alloc)
+{
+	insert(end(), init.begin(), init.end());
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>::~indexed_list()
+{
+	if (m_headNode)
+	{
+		node_allocator_type nodeAlloc(m_alloc);
+		clear();
+		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, m_headNode, 1);
+		m_headNode = nullptr;
+	}
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>& indexed_list<T, Allocator>::operator=(const indexed_list& other)
+{
+	if (this != &other)
+		assign(other.begin(), other.end());
+	return *this;
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>& indexed_list<T, Allocator>::operator=(indexed_list&& other)
+{
+	if (this != &other)
+	{
+		clear();
+		splice(end(), other);
+	}
+	return *this;
+}
+
+template<class T, class Allocator>
+indexed_list<T, Allocator>& indexed_list<T, Allocator>::operator=(std::initializer_list<T> init)
+{
+	assign(init);
+	return *this;
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::assign(size_type count, const T& value)
+{
+	clear();
+	insert(end(), count, value);
+}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+void indexed_list<T, Allocator>::assign(InputIt first, InputIt last)
+{
+	clear();
+	insert(end(), first, last);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::assign(std::initializer_list<T> init)
+{
+	clear();
+	insert(end(), init);
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::allocator_type indexed_list<T, Allocator>::get_allocator() const
+{
+	return m_alloc;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::reference indexed_list<T, Allocator>::front()
+{
+	return m_headNode->next->val;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_reference indexed_list<T, Allocator>::front() const
+{
+	return m_headNode->next->val;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::reference indexed_list<T, Allocator>::back()
+{
+	return m_headNode->prev->val;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_reference indexed_list<T, Allocator>::back() const
+{
+	return m_headNode->prev->val;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::nth(size_type index)
+{
+	return iterator(tree::nth(m_headNode, index));
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_iterator indexed_list<T, Allocator>::nth(size_type index) const
+{
+	return const_iterator(tree::nth(m_headNode, index));
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::size_type indexed_list<T, Allocator>::index_of(const_iterator pos) const
+{
+	return tree::indexOf(pos.getNode());
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::begin() noexcept
+{
+	return iterator(m_headNode->next);
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_iterator indexed_list<T, Allocator>::begin() const noexcept
+{
+	return const_iterator(m_headNode->next);
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_iterator indexed_list<T, Allocator>::cbegin() const noexcept
+{
+	return const_iterator(m_headNode->next);
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::end() noexcept
+{
+	return iterator(m_headNode);
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_iterator indexed_list<T, Allocator>::end() const noexcept
+{
+	return const_iterator(m_headNode);
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_iterator indexed_list<T, Allocator>::cend() const noexcept
+{
+	return const_iterator(m_headNode);
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::reverse_iterator indexed_list<T, Allocator>::rbegin() noexcept
+{
+	return reverse_iterator(end());
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_reverse_iterator indexed_list<T, Allocator>::rbegin() const noexcept
+{
+	return const_reverse_iterator(end());
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_reverse_iterator indexed_list<T, Allocator>::crbegin() const noexcept
+{
+	return const_reverse_iterator(end());
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::reverse_iterator indexed_list<T, Allocator>::rend() noexcept
+{
+	return reverse_iterator(begin());
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_reverse_iterator indexed_list<T, Allocator>::rend() const noexcept
+{
+	return const_reverse_iterator(begin());
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::const_reverse_iterator indexed_list<T, Allocator>::crend() const noexcept
+{
+	return const_reverse_iterator(begin());
+}
+
+template<class T, class Allocator>
+bool indexed_list<T, Allocator>::empty() const noexcept
+{
+	return m_size == 0;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::size_type indexed_list<T, Allocator>::size() const noexcept
+{
+	return m_size;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::size_type indexed_list<T, Allocator>::max_size() const noexcept
+{
+	return std::numeric_limits<size_type>::max();
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::clear() noexcept
+{
+	node_type *node = m_headNode->next;
+	while (node != m_headNode)
+		node = destroyNode(node);
+	m_headNode->next = m_headNode->prev = m_headNode;
+	m_headNode->left = nullptr;
+	m_size = 0;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::insert(const_iterator pos, const value_type& value)
+{
+	return emplace(pos, value);
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::insert(const_iterator pos, value_type&& value)
+{
+	return emplace(pos, std::move(value));
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::insert(const_iterator pos, size_type count, const value_type& value)
+{
+	if (count == 0)
+		return iterator(pos.getNode());
+	iterator res = insert(pos, value);
+	while (--count > 0)
+		insert(pos, value);
+	return res;
+}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::insert(const_iterator pos, InputIt first, InputIt last)
+{
+	if (first == last)
+		return iterator(pos.getNode());
+	iterator res = insert(pos, *first);
+	for (++first; first != last; ++first)
+		insert(pos, *first);
+	return res;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::insert(const_iterator pos, std::initializer_list<T> init)
+{
+	return insert(pos, init.begin(), init.end());
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::emplace(const_iterator pos, Args&&... args)
+{
+	node_type *node = allocateNode();
+	try
+	{
+		std::allocator_traits<Allocator>::construct(m_alloc, &node->val, std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		node_allocator_type nodeAlloc(m_alloc);
+		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
+		throw;
+	}
+	linkNode(node, pos.getNode());
+	return iterator(node);
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::erase(const_iterator pos)
+{
+	node_type *node = pos.getNode();
+	tree::erase(node);
+	node->prev->next = node->next;
+	node->next->prev = node->prev;
+	m_size--;
+	return iterator(destroyNode(node));
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::iterator indexed_list<T, Allocator>::erase(const_iterator first, const_iterator last)
+{
+	if (first == last)
+		return iterator(last.getNode());
+	if (first == begin() && last == end())
+	{
+		clear();
+		return end();
+	}
+	size_type from = index_of(first);
+	size_type to = index_of(last);
+	node_type *left, *middle, *right;
+	tree::split(m_headNode->left, from, left, right);
+	tree::split(right, to - from, middle, right);
+	tree::setRoot(m_headNode, tree::merge(left, right));
+
+	node_type *firstNode = first.getNode();
+	node_type *lastNode = last.getNode();
+	firstNode->prev->next = lastNode;
+	lastNode->prev = firstNode->prev;
+	while (firstNode != lastNode)
+		firstNode = destroyNode(firstNode);
+	m_size -= to - from;
+	return iterator(lastNode);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::push_front(const value_type& value)
+{
+	emplace(begin(), value);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::push_front(value_type&& value)
+{
+	emplace(begin(), std::move(value));
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::push_back(const value_type& value)
+{
+	emplace(end(), value);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::push_back(value_type&& value)
+{
+	emplace(end(), std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename indexed_list<T, Allocator>::reference indexed_list<T, Allocator>::emplace_back(Args&&... args)
+{
+	return *emplace(end(), std::forward<Args>(args)...);
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename indexed_list<T, Allocator>::reference indexed_list<T, Allocator>::emplace_front(Args&&... args)
+{
+	return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::pop_back()
+{
+	erase(const_iterator(m_headNode->prev));
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::pop_front()
+{
+	erase(begin());
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::resize(size_type count)
+{
+	if (count < size())
+		erase(nth(count), end());
+	while (size() < count)
+		emplace_back();
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::resize(size_type count, const value_type& value)
+{
+	if (count < size())
+		erase(nth(count), end());
+	else
+		insert(end(), count - size(), value);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::swap(indexed_list& other)
+{
+	std::swap(m_alloc, other.m_alloc);
+	std::swap(m_headNode, other.m_headNode);
+	std::swap(m_size, other.m_size);
+	std::swap(m_seed, other.m_seed);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::merge(indexed_list& other)
+{
+	merge(other, [](const T& left, const T& right) { return left < right; });
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::merge(indexed_list&& other)
+{
+	merge(other);
+}
+
+template<class T, class Allocator>
+template <class Compare>
+void indexed_list<T, Allocator>::merge(indexed_list& other, Compare comp)
+{
+	if (this == &other || other.empty())
+		return;
+	node_type *lastOwn = m_headNode->prev;
+	splice(end(), other);
+	if (lastOwn == m_headNode)
+		return;
+	node_type *second = lastOwn->next;
+	lastOwn->next = nullptr;
+	m_headNode->prev->next = nullptr;
+	relink(mergeChains(m_headNode->next, second, comp));
+}
+
+template<class T, class Allocator>
+template <class Compare>
+void indexed_list<T, Allocator>::merge(indexed_list&& other, Compare comp)
+{
+	merge(other, comp);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::splice(const_iterator pos, indexed_list& other)
+{
+	commonSplice(pos, other, other.begin(), other.end());
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::splice(const_iterator pos, indexed_list&& other)
+{
+	commonSplice(pos, other, other.begin(), other.end());
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::splice(const_iterator pos, indexed_list& other, const_iterator it)
+{
+	commonSplice(pos, other, it, const_iterator(it.getNode()->next));
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::splice(const_iterator pos, indexed_list&& other, const_iterator it)
+{
+	commonSplice(pos, other, it, const_iterator(it.getNode()->next));
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::splice(const_iterator pos, indexed_list& other, const_iterator first, const_iterator last)
+{
+	commonSplice(pos, other, first, last);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::splice(const_iterator pos, indexed_list&& other, const_iterator first, const_iterator last)
+{
+	commonSplice(pos, other, first, last);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::remove(const value_type& value)
+{
+	remove_if([&value](const value_type& v) { return value == v; });
+}
+
+template<class T, class Allocator>
+template<class UnaryPredicate>
+void indexed_list<T, Allocator>::remove_if(UnaryPredicate p)
+{
+	size_type removed = 0;
+	node_type *node = m_headNode->next;
+	while (node != m_headNode)
+	{
+		if (p(node->val))
+		{
+			node->prev->next = node->next;
+			node->next->prev = node->prev;
+			node = destroyNode(node);
+			removed++;
+		}
+		else
+			node = node->next;
+	}
+	if (removed == 0)
+		return;
+	m_size -= removed;
+	tree::rebuild(m_headNode);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::reverse() noexcept
+{
+	// Mirroring every node of the treap reverses the order it encodes while
+	// keeping the counts and priorities valid
+	node_type *node = m_headNode;
+	do
+	{
+		std::swap(node->next, node->prev);
+		if (node != m_headNode)
+			std::swap(node->left, node->right);
+		node = node->prev;
+	} while (node != m_headNode);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::unique()
+{
+	unique([](const T& left, const T& right) { return left == right; });
+}
+
+template<class T, class Allocator>
+template<class BinaryPredicate>
+void indexed_list<T, Allocator>::unique(BinaryPredicate p)
+{
+	if (size() < 2)
+		return;
+	size_type removed = 0;
+	node_type *kept = m_headNode->next;
+	node_type *node = kept->next;
+	while (node != m_headNode)
+	{
+		if (p(kept->val, node->val))
+		{
+			node->prev->next = node->next;
+			node->next->prev = node->prev;
+			node = destroyNode(node);
+			removed++;
+		}
+		else
+		{
+			kept = node;
+			node = node->next;
+		}
+	}
+	if (removed == 0)
+		return;
+	m_size -= removed;
+	tree::rebuild(m_headNode);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::sort()
+{
+	sort([](const T& left, const T& right) { return left < right; });
+}
+
+template<class T, class Allocator>
+template<class Compare>
+void indexed_list<T, Allocator>::sort(Compare comp)
+{
+	if (size() < 2)
+		return;
+	m_headNode->prev->next = nullptr;
+	relink(sortChain(m_headNode->next, m_size, comp));
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::node_type* indexed_list<T, Allocator>::allocateNode()
+{
+	node_allocator_type nodeAlloc(m_alloc);
+	node_type *res = std::allocator_traits<node_allocator_type>::allocate(nodeAlloc, 1);
+	res->next = res->prev = nullptr;
+	res->parent = res->left = res->right = nullptr;
+	res->count = 1;
+	res->priority = nextPriority();
+	return res;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::node_type* indexed_list<T, Allocator>::allocateHeadNode()
+{
+	node_allocator_type nodeAlloc(m_alloc);
+	node_type *res = std::allocator_traits<node_allocator_type>::allocate(nodeAlloc, 1);
+	res->next = res->prev = res;
+	res->parent = res->left = res->right = nullptr;
+	res->count = 0;
+	res->priority = 0;
+	return res;
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::linkNode(node_type* node, node_type* pos)
+{
+	node_type *left, *right;
+	tree::split(m_headNode->left, tree::indexOf(pos), left, right);
+	tree::setRoot(m_headNode, tree::merge(tree::merge(left, node), right));
+
+	node->prev = pos->prev;
+	node->next = pos;
+	pos->prev->next = node;
+	pos->prev = node;
+	m_size++;
+}
+
+template<class T, class Allocator>
+typename indexed_list<T, Allocator>::node_type* indexed_list<T, Allocator>::destroyNode(node_type* node)
+{
+	node_allocator_type nodeAlloc(m_alloc);
+	std::allocator_traits<Allocator>::destroy(m_alloc, &node->val);
+	node_type *res = node->next;
+	std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
+	return res;
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::relink(node_type* first)
+{
+	node_type *prev = m_headNode;
+	for (node_type *node = first; node != nullptr; node = node->next)
+	{
+		node->prev = prev;
+		prev->next = node;
+		prev = node;
+	}
+	prev->next = m_headNode;
+	m_headNode->prev = prev;
+	tree::rebuild(m_headNode);
+}
+
+template<class T, class Allocator>
+void indexed_list<T, Allocator>::commonSplice(const_iterator pos, indexed_list& other, const_iterator first, const_iterator last)
+{
+	if (first == last)
+		return;
+	if (this == &other && (pos == first || pos == last))
+		return;
+	if (!ListNodeTransfer<Allocator>::canRelinkAll(m_alloc, other.m_alloc))
+	{
+		for (const_iterator it = first; it != last; ++it)
+			emplace(pos, std::move(it.getNode()->val));
+		other.erase(first, last);
+		return;
+	}
+
+	node_type *firstNode = first.getNode();
+	node_type *lastNode = last.getNode();
+	node_type *tailNode = lastNode->prev;
+	size_type from = other.index_of(first);
+	size_type count = other.index_of(last) - from;
+
+	node_type *left, *middle, *right;
+	tree::split(other.m_headNode->left, from, left, right);
+	tree::split(right, count, middle, right);
+	tree::setRoot(other.m_headNode, tree::merge(left, right));
+	firstNode->prev->next = lastNode;
+	lastNode->prev = firstNode->prev;
+	other.m_size -= count;
+
+	node_type *posNode = pos.getNode();
+	tree::split(m_headNode->left, tree::indexOf(posNode), left, right);
+	tree::setRoot(m_headNode, tree::merge(tree::merge(left, middle), right));
+	firstNode->prev = posNode->prev;
+	posNode->prev->next = firstNode;
+	tailNode->next = posNode;
+	posNode->prev = tailNode;
+	m_size += count;
+}
+
+template<class T, class Allocator>
+unsigned indexed_list<T, Allocator>::nextPriority()
+{
+	m_seed ^= m_seed << 13;
+	m_seed ^= m_seed >> 17;
+	m_seed ^= m_seed << 5;
+	return m_seed;
+}
+
+template<class T, class Allocator>
+bool operator==(const indexed_list<T, Allocator>& left, const indexed_list<T, Allocator>& right)
+{
+	if (left.size() != right.size())
+		return false;
+	auto itLeft = left.begin();
+	auto itRight = right.begin();
+	while (itLeft != left.end() && itRight != right.end())
+	{
+		if (*itLeft != *itRight)
+			return false;
+		++itLeft;
+		++itRight;
+	}
+	return true;
+}
+
+template<class T, class Allocator>
+bool operator!=(const indexed_list<T, Allocator>& left, const indexed_list<T, Allocator>& right)
+{
+	return !(left == right);
+}
+
+template<class T, class Allocator>
+bool operator<(const indexed_list<T, Allocator>& left, const indexed_list<T, Allocator>& right)
+{
+	auto itLeft = left.begin();
+	auto itRight = right.begin();
+	while (itLeft != left.end() && itRight != right.end())
+	{
+		if (*itLeft < *itRight)
+			return true;
+		if (*itRight < *itLeft)
+			return false;
+		++itLeft;
+		++itRight;
+	}
+	return itLeft == left.end() && itRight != right.end();
+}
+
+template<class T, class Allocator>
+bool operator<=(const indexed_list<T, Allocator>& left, const indexed_list<T, Allocator>& right)
+{
+	return !(right < left);
+}
+
+template<class T, class Allocator>
+bool operator>(const indexed_list<T, Allocator>& left, const indexed_list<T, Allocator>& right)
+{
+	return right < left;
+}
+
+template<class T, class Allocator>
+bool operator>=(const indexed_list<T, Allocator>& left, const indexed_list<T, Allocator>& right)
+{
+	return !(left < right);
+}
+
+}
+
+namespace std
+{
+
+template<class T, class Allocator>
+void swap(blk::indexed_list<T, Allocator>& left, blk::indexed_list<T, Allocator>& right)
+{
+	left.swap(right);
+}
+
+}
@@ -7,12 +7,174 @@ namespace blk
 class not_implemented : public std::exception
 {
 public:
-	virtual char const * what() const
+	virtual char const * what() const noexcept
 	{
 		return "Function is not implemented yet";
 	}
 };
 
+// Prefetching helpers
+
+template<class Node>
+void prefetchNode(const Node* node)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(&node->next);
+	__builtin_prefetch(&node->val);
+#elif defined(_MSC_VER)
+	_mm_prefetch(reinterpret_cast<const char*>(&node->next), _MM_HINT_T0);
+	_mm_prefetch(reinterpret_cast<const char*>(&node->val), _MM_HINT_T0);
+#endif
+}
+
+template<class Node>
+ListPrefetcher<Node>::ListPrefetcher(const Node* first, const Node* last, size_t distance) :
+	m_ahead(first),
+	m_last(last)
+{
+	if (distance == 0)
+		m_ahead = m_last;
+	for (size_t i = 0; i < distance && m_ahead != m_last; i++)
+	{
+		prefetchNode(m_ahead);
+		m_ahead = m_ahead->next;
+	}
+}
+
+template<class Node>
+void ListPrefetcher<Node>::advance()
+{
+	if (m_ahead == m_last)
+		return;
+	prefetchNode(m_ahead);
+	m_ahead = m_ahead->next;
+}
+
+// Chain sorting helpers
+
+template<class Node, class Compare>
+Node* sortChain(Node* first, size_t size, Compare comp)
+{
+	if (size < 2)
+		return first;
+	Node *middle = first;
+	for (size_t i = 1; i < size / 2; i++)
+		middle = middle->next;
+	Node *second = middle->next;
+	middle->next = nullptr;
+	first = sortChain(first, size / 2, comp);
+	second = sortChain(second, size - size / 2, comp);
+	return mergeChains(first, second, comp);
+}
+
+template<class Node, class Compare>
+Node* mergeChains(Node* left, Node* right, Compare comp)
+{
+	Node *res = nullptr;
+	Node **tail = &res;
+	ListPrefetcher<Node> leftAhead(left, nullptr);
+	ListPrefetcher<Node> rightAhead(right, nullptr);
+	while (left != nullptr && right != nullptr)
+	{
+		if (comp(right->val, left->val))
+		{
+			rightAhead.advance();
+			*tail = right;
+			right = right->next;
+		}
+		else
+		{
+			leftAhead.advance();
+			*tail = left;
+			left = left->next;
+		}
+		tail = &(*tail)->next;
+	}
+	*tail = left != nullptr ? left : right;
+	return res;
+}
+
+template<class Node, class Record>
+Node* relinkRecords(std::vector<Record>& records)
+{
+	for (size_t i = 1; i < records.size(); i++)
+		records[i - 1].node->next = records[i].node;
+	records.back().node->next = nullptr;
+	return records.front().node;
+}
+
+template<class Node, class KeyFn>
+Node* sortChainByKey(Node* first, size_t size, KeyFn key, std::true_type)
+{
+	using key_type = typename std::decay<decltype(key(first->val))>::type;
+	using radix_type = typename std::make_unsigned<key_type>::type;
+	using record_type = ListSortRecord<radix_type, Node>;
+	const size_t digits = sizeof(radix_type);
+	// Flipping the sign bit maps signed keys onto the same unsigned order
+	const radix_type flip = std::is_signed<key_type>::value ? radix_type(radix_type(1) << (digits * 8 - 1)) : radix_type(0);
+
+	std::vector<record_type> records(size);
+	std::vector<size_t> counts(digits * 256, 0);
+	ListPrefetcher<Node> ahead(first, nullptr);
+	for (size_t i = 0; i < size; i++, first = first->next)
+	{
+		ahead.advance();
+		radix_type k = static_cast<radix_type>(key(first->val)) ^ flip;
+		records[i].key = k;
+		records[i].node = first;
+		for (size_t d = 0; d < digits; d++)
+			counts[d * 256 + ((k >> (d * 8)) & 0xff)]++;
+	}
+
+	std::vector<record_type> buffer(size);
+	for (size_t d = 0; d < digits; d++)
+	{
+		size_t *count = &counts[d * 256];
+		// A digit shared by every key leaves the order unchanged
+		if (count[(records[0].key >> (d * 8)) & 0xff] == size)
+			continue;
+		size_t offset = 0;
+		for (size_t b = 0; b < 256; b++)
+		{
+			size_t c = count[b];
+			count[b] = offset;
+			offset += c;
+		}
+		for (const record_type& record : records)
+			buffer[count[(record.key >> (d * 8)) & 0xff]++] = record;
+		records.swap(buffer);
+	}
+	return relinkRecords<Node>(records);
+}
+
+template<class Node, class KeyFn>
+Node* sortChainByKey(Node* first, size_t size, KeyFn key, std::false_type)
+{
+	using key_type = typename std::decay<decltype(key(first->val))>::type;
+	using record_type = ListSortRecord<key_type, Node>;
+
+	std::vector<record_type> records;
+	records.reserve(size);
+	ListPrefetcher<Node> ahead(first, nullptr);
+	for (; first != nullptr; first = first->next)
+	{
+		ahead.advance();
+		records.push_back(record_type { key(first->val), first });
+	}
+	std::stable_sort(records.begin(), records.end(), [](const record_type& left, const record_type& right) { return left.key < right.key; });
+	return relinkRecords<Node>(records);
+}
+
+template<class Node, class KeyFn>
+Node* sortChainByKey(Node* first, size_t size, KeyFn key)
+{
+	if (size < 2)
+		return first;
+	using key_type = typename std::decay<decltype(key(first->val))>::type;
+	using is_radix = std::integral_constant<bool, std::is_integral<key_type>::value && !std::is_same<key_type, bool>::value>;
+	return sortChainByKey(first, size, key, is_radix());
+}
+
 // ListIterator implementation
 
 template<class T, bool IsConst>
@@ -39,7 +201,7 @@ template<class T, bool IsConst>
 template<bool B>
 bool ListIterator<T, IsConst>::operator==(const ListIterator<value_type, B>& it) const
 {
-	return m_item == it.m_item;
+	return m_item == it.getNode();
 }
 
 template<class T, bool IsConst>
@@ -119,6 +281,252 @@ ListNode<typename ListIterator<T, IsConst>::value_type> * const ListIterator<T,
 	return m_item;
 }
 
+// ListReverseIterator implementation
+
+template<class T, bool IsConst>
+ListReverseIterator<T, IsConst>::ListReverseIterator() : m_item(nullptr) {}
+
+template<class T, bool IsConst>
+ListReverseIterator<T, IsConst>::ListReverseIterator(const ListReverseIterator<value_type, false>& it) : m_item(it.getNode()) {}
+
+template<class T, bool IsConst>
+ListReverseIterator<T, IsConst>::ListReverseIterator(ListNode<value_type>* node) : m_item(node) {}
+
+template<class T, bool IsConst>
+ListReverseIterator<T, IsConst>::ListReverseIterator(const ListIterator<value_type, IsConst>& base) : m_item(base.getNode()->prev) {}
+
+template<class T, bool IsConst>
+template<bool B>
+bool ListReverseIterator<T, IsConst>::operator==(const ListReverseIterator<value_type, B>& it) const
+{
+	return m_item == it.getNode();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool ListReverseIterator<T, IsConst>::operator!=(const ListReverseIterator<value_type, B>& it) const
+{
+	return !(*this == it);
+}
+
+template<class T, bool IsConst>
+ListReverseIterator<T, IsConst>& ListReverseIterator<T, IsConst>::operator++()
+{
+	m_item = m_item->prev;
+	return *this;
+}
+
+template<class T, bool IsConst>
+ListReverseIterator<T, IsConst>& ListReverseIterator<T, IsConst>::operator--()
+{
+	m_item = m_item->next;
+	return *this;
+}
+
+template<class T, bool IsConst>
+ListReverseIterator<T, IsConst> ListReverseIterator<T, IsConst>::operator++(int)
+{
+	ListReverseIterator res(*this);
+	m_item = m_item->prev;
+	return res;
+}
+
+template<class T, bool IsConst>
+ListReverseIterator<T, IsConst> ListReverseIterator<T, IsConst>::operator--(int)
+{
+	ListReverseIterator res(*this);
+	m_item = m_item->next;
+	return res;
+}
+
+template<class T, bool IsConst>
+typename ListReverseIterator<T, IsConst>::reference ListReverseIterator<T, IsConst>::operator*() const
+{
+	return m_item->val;
+}
+
+template<class T, bool IsConst>
+typename ListReverseIterator<T, IsConst>::pointer ListReverseIterator<T, IsConst>::operator->() const
+{
+	return &m_item->val;
+}
+
+template<class T, bool IsConst>
+ListIterator<T, IsConst> ListReverseIterator<T, IsConst>::base() const
+{
+	return ListIterator<T, IsConst>(m_item->next);
+}
+
+template<class T, bool IsConst>
+ListNode<T>* ListReverseIterator<T, IsConst>::getNode() const
+{
+	return m_item;
+}
+
+// ListReversedView implementation
+
+template<class List>
+ListReversedView<List>::ListReversedView(List& list) noexcept : m_list(&list) {}
+
+template<class List>
+typename ListReversedView<List>::iterator ListReversedView<List>::begin() const noexcept
+{
+	return m_list->rbegin();
+}
+
+template<class List>
+typename ListReversedView<List>::iterator ListReversedView<List>::end() const noexcept
+{
+	return m_list->rend();
+}
+
+template<class List>
+bool ListReversedView<List>::empty() const noexcept
+{
+	return m_list->empty();
+}
+
+template<class List>
+typename ListReversedView<List>::size_type ListReversedView<List>::size() const noexcept
+{
+	return m_list->size();
+}
+
+template<class List>
+typename ListReversedView<List>::reference ListReversedView<List>::front() const
+{
+	return m_list->back();
+}
+
+template<class List>
+typename ListReversedView<List>::reference ListReversedView<List>::back() const
+{
+	return m_list->front();
+}
+
+// ListNodeTransfer implementation
+
+template<class Allocator>
+bool ListNodeTransfer<Allocator>::canRelinkAll(const Allocator& to, const Allocator& from)
+{
+	return to == from;
+}
+
+template<class Allocator>
+bool ListNodeTransfer<Allocator>::canRelink(const Allocator& to, const Allocator& from, const void*)
+{
+	return to == from;
+}
+
+// ListValueHash and ListValueEqual implementation
+
+template<class T, class Hash>
+size_t ListValueHash<T, Hash>::operator()(const T* value) const
+{
+	return hash(*value);
+}
+
+template<class T, class KeyEqual>
+bool ListValueEqual<T, KeyEqual>::operator()(const T* left, const T* right) const
+{
+	return equal(*left, *right);
+}
+
+// ListNodeHandle implementation
+
+template<class T, class Allocator>
+ListNodeHandle<T, Allocator>::ListNodeHandle() noexcept :
+	m_node(nullptr),
+	m_alloc() {}
+
+template<class T, class Allocator>
+ListNodeHandle<T, Allocator>::ListNodeHandle(ListNode<T>* node, const Allocator& alloc) :
+	m_node(node),
+	m_alloc(alloc) {}
+
+template<class T, class Allocator>
+ListNodeHandle<T, Allocator>::ListNodeHandle(ListNodeHandle&& other) noexcept :
+	m_node(other.m_node),
+	m_alloc(std::move(other.m_alloc))
+{
+	other.m_node = nullptr;
+}
+
+template<class T, class Allocator>
+ListNodeHandle<T, Allocator>& ListNodeHandle<T, Allocator>::operator=(ListNodeHandle&& other)
+{
+	if (this == &other)
+		return *this;
+	reset();
+	m_node = other.m_node;
+	m_alloc = std::move(other.m_alloc);
+	other.m_node = nullptr;
+	return *this;
+}
+
+template<class T, class Allocator>
+ListNodeHandle<T, Allocator>::~ListNodeHandle()
+{
+	reset();
+}
+
+template<class T, class Allocator>
+bool ListNodeHandle<T, Allocator>::empty() const noexcept
+{
+	return m_node == nullptr;
+}
+
+template<class T, class Allocator>
+ListNodeHandle<T, Allocator>::operator bool() const noexcept
+{
+	return m_node != nullptr;
+}
+
+template<class T, class Allocator>
+typename ListNodeHandle<T, Allocator>::allocator_type ListNodeHandle<T, Allocator>::get_allocator() const
+{
+	return m_alloc;
+}
+
+template<class T, class Allocator>
+typename ListNodeHandle<T, Allocator>::value_type& ListNodeHandle<T, Allocator>::value() const
+{
+	return m_node->val;
+}
+
+template<class T, class Allocator>
+void ListNodeHandle<T, Allocator>::swap(ListNodeHandle& other) noexcept
+{
+	std::swap(m_node, other.m_node);
+	std::swap(m_alloc, other.m_alloc);
+}
+
+template<class T, class Allocator>
+ListNode<T>* ListNodeHandle<T, Allocator>::release() noexcept
+{
+	ListNode<T> *res = m_node;
+	m_node = nullptr;
+	return res;
+}
+
+template<class T, class Allocator>
+ListNode<T>* ListNodeHandle<T, Allocator>::getNode() const noexcept
+{
+	return m_node;
+}
+
+template<class T, class Allocator>
+void ListNodeHandle<T, Allocator>::reset()
+{
+	if (!m_node)
+		return;
+	using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<ListNode<T>>;
+	node_allocator_type nodeAlloc(m_alloc);
+	std::allocator_traits<Allocator>::destroy(m_alloc, &m_node->val);
+	std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, m_node, 1);
+	m_node = nullptr;
+}
+
 // List implementation
 
 template<class T, class Allocator>
@@ -200,7 +608,8 @@ list<T, Allocator>::list(list&& other, const Allocator& alloc)
 		m_alloc = alloc;
 		m_headNode = allocateHeadNode();
 		m_size = 0;
-		insert(begin(), other.begin(), other.end());
+		for (auto it = other.begin(); it != other.end(); ++it)
+			emplace_back(std::move(*it));
 		other.~list();
 	}
 }
@@ -217,7 +626,7 @@ list<T, Allocator>::~list()
 {
 	if (m_headNode)
 	{
-		auto nodeAlloc = node_allocator_type();
+		node_allocator_type nodeAlloc(m_alloc);
 		clear();
 		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, m_headNode, 1);
 		m_headNode = nullptr;
@@ -285,13 +694,13 @@ typename list<T, Allocator>::const_reference list<T, Allocator>::front() const
 template<class T, class Allocator>
 typename list<T, Allocator>::reference list<T, Allocator>::back()
 {
-	return *rbegin();
+	return m_headNode->prev->val;
 }
 
 template<class T, class Allocator>
 typename list<T, Allocator>::const_reference list<T, Allocator>::back() const
 {
-	return *rbegin();
+	return m_headNode->prev->val;
 }
 
 template<class T, class Allocator>
@@ -333,37 +742,49 @@ typename list<T, Allocator>::const_iterator list<T, Allocator>::cend() const noe
 template<class T, class Allocator>
 typename list<T, Allocator>::reverse_iterator list<T, Allocator>::rbegin() noexcept
 {
-	return reverse_iterator(end());
+	return reverse_iterator(m_headNode->prev);
 }
 
 template<class T, class Allocator>
 typename list<T, Allocator>::const_reverse_iterator list<T, Allocator>::rbegin() const noexcept
 {
-	return const_reverse_iterator(end());
+	return const_reverse_iterator(m_headNode->prev);
 }
 
 template<class T, class Allocator>
 typename list<T, Allocator>::const_reverse_iterator list<T, Allocator>::crbegin() const noexcept
 {
-	return const_reverse_iterator(end());
+	return const_reverse_iterator(m_headNode->prev);
 }
 
 template<class T, class Allocator>
 typename list<T, Allocator>::reverse_iterator list<T, Allocator>::rend() noexcept
 {
-	return reverse_iterator(begin());
+	return reverse_iterator(m_headNode);
 }
 
 template<class T, class Allocator>
 typename list<T, Allocator>::const_reverse_iterator list<T, Allocator>::rend() const noexcept
 {
-	return const_reverse_iterator(begin());
+	return const_reverse_iterator(m_headNode);
 }
 
 template<class T, class Allocator>
 typename list<T, Allocator>::const_reverse_iterator list<T, Allocator>::crend() const noexcept
 {
-	return const_reverse_iterator(begin());
+	return const_reverse_iterator(m_headNode);
+}
+
+template<class T, class Allocator>
+ListReversedView<list<T, Allocator>> list<T, Allocator>::reversed() noexcept
+{
+	return ListReversedView<list>(*this);
+}
+
+template<class T, class Allocator>
+ListReversedView<const list<T, Allocator>> list<T, Allocator>::reversed() const noexcept
+{
+	return ListReversedView<const list>(*this);
 }
 
 template<class T, class Allocator>
@@ -387,16 +808,16 @@ typename list<T, Allocator>::size_type list<T, Allocator>::max_size() const noex
 template<class T, class Allocator>
 void list<T, Allocator>::clear() noexcept
 {
+	list_node_type *first = m_headNode->next;
+	m_headNode->next = m_headNode->prev = m_headNode;
+	destroyChain(first, m_headNode);
 	m_size = 0;
-	node_type *node = m_headNode->next;
-	while (node != m_headNode)
-		node = destroyNode(node);
 }
 
 template<class T, class Allocator>
 typename list<T, Allocator>::iterator list<T, Allocator>::insert(const_iterator pos, const value_type& value)
 {
-	node_type *node = insertNode(pos.getNode()->prev, pos.getNode());
+	list_node_type *node = insertNode(pos.getNode()->prev, pos.getNode());
 	std::allocator_traits<Allocator>::construct(m_alloc, &node->val, value);
 	m_size++;
 	return iterator(node);
@@ -435,16 +856,42 @@ typename list<T, Allocator>::iterator list<T, Allocator>::insert(const_iterator
 	return insert(init.begin(), init.end());
 }
 
+template<class T, class Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(const_iterator pos, node_type&& handle)
+{
+	if (handle.empty())
+		return end();
+	if (!ListNodeTransfer<Allocator>::canRelink(m_alloc, handle.get_allocator(), handle.getNode()))
+	{
+		iterator res = emplace(pos, std::move(handle.value()));
+		handle = node_type();
+		return res;
+	}
+	list_node_type *node = handle.release();
+	attachNode(node, pos.getNode());
+	return iterator(node);
+}
+
 template<class T, class Allocator>
 template<class... Args>
 typename list<T, Allocator>::iterator list<T, Allocator>::emplace(const_iterator pos, Args&&... args)
 {
-	node_type *node = insertNode(pos.getNode()->prev, pos.getNode());
+	list_node_type *node = insertNode(pos.getNode()->prev, pos.getNode());
 	std::allocator_traits<Allocator>::construct(m_alloc, &node->val, std::forward<Args>(args)...);
 	m_size++;
 	return iterator(node);
 }
 
+template<class T, class Allocator>
+typename list<T, Allocator>::node_type list<T, Allocator>::extract(const_iterator pos)
+{
+	list_node_type *node = pos.getNode();
+	node->prev->next = node->next;
+	node->next->prev = node->prev;
+	m_size--;
+	return node_type(node, m_alloc);
+}
+
 template<class T, class Allocator>
 typename list<T, Allocator>::iterator list<T, Allocator>::erase(const_iterator pos)
 {
@@ -452,6 +899,7 @@ typename list<T, Allocator>::iterator list<T, Allocator>::erase(const_iterator p
 	pos.getNode()->next->prev = pos.getNode()->prev;
 	iterator res(pos.getNode()->next);
 	destroyNode(pos.getNode());
+	m_size--;
 	return res;
 }
 
@@ -465,9 +913,14 @@ typename list<T, Allocator>::iterator list<T, Allocator>::erase(const_iterator f
 	}
 	else
 	{
-		while (first != last)
-			first = erase(first);
-		return first;
+		list_node_type *firstNode = first.getNode();
+		list_node_type *lastNode = last.getNode();
+		if (firstNode == lastNode)
+			return iterator(lastNode);
+		firstNode->prev->next = lastNode;
+		lastNode->prev = firstNode->prev;
+		m_size -= destroyChain(firstNode, lastNode);
+		return iterator(lastNode);
 	}
 }
 
@@ -506,7 +959,7 @@ template<class T, class Allocator>
 template<class... Args>
 typename list<T, Allocator>::reference list<T, Allocator>::emplace_front(Args&&... args)
 {
-	return *emplace<Args...>(begin(), args...);
+	return *emplace<Args...>(begin(), std::forward<Args>(args)...);
 }
 
 template<class T, class Allocator>
@@ -573,29 +1026,90 @@ void list<T, Allocator>::swap(list& other)
 }
 
 template<class T, class Allocator>
-void list<T, Allocator>::merge(list& other)
+list<T, Allocator> list<T, Allocator>::split(const_iterator pos)
 {
+	list tail(m_alloc);
+	tail.commonSplice(tail.cend(), *this, pos, cend());
+	return tail;
+}
 
+template<class T, class Allocator>
+list<T, Allocator> list<T, Allocator>::split(const_iterator pos, size_type count)
+{
+	list tail(m_alloc);
+	tail.commonSplice(tail.cend(), *this, pos, cend(), count);
+	return tail;
+}
+
+template<class T, class Allocator>
+std::vector<list<T, Allocator>> list<T, Allocator>::split_into(size_type k)
+{
+	std::vector<list> parts;
+	if (k == 0)
+		return parts;
+	parts.reserve(k);
+	for (size_type i = 0; i < k; i++)
+		parts.emplace_back(m_alloc);
+
+	// The first size % k parts take one extra element
+	const size_type total = m_size;
+	for (size_type i = 0; i < k; i++)
+	{
+		size_type count = total / k + (i < total % k ? 1 : 0);
+		const_iterator first = cbegin();
+		const_iterator last = first;
+		for (size_type j = 0; j < count; j++)
+			++last;
+		parts[i].commonSplice(parts[i].cend(), *this, first, last, count);
+	}
+	return parts;
+}
+
+template<class T, class Allocator>
+void list<T, Allocator>::merge(list& other)
+{
+	merge(other, [](const T& left, const T& right) { return left < right; });
 }
 
 template<class T, class Allocator>
 void list<T, Allocator>::merge(list&& other)
 {
-	throw not_implemented();
+	merge(other);
 }
 
 template<class T, class Allocator>
 template <class Compare>
 void list<T, Allocator>::merge(list& other, Compare comp)
 {
-	throw not_implemented();
+	if (this == &other || other.empty())
+		return;
+	if (!ListNodeTransfer<Allocator>::canRelinkAll(m_alloc, other.m_alloc))
+	{
+		const_iterator pos = cbegin();
+		while (!other.empty())
+		{
+			while (pos != cend() && !comp(other.front(), *pos))
+				++pos;
+			commonSplice(pos, other, other.cbegin());
+		}
+		return;
+	}
+
+	m_headNode->prev->next = nullptr;
+	other.m_headNode->prev->next = nullptr;
+	list_node_type *first = mergeChains(empty() ? nullptr : m_headNode->next, other.m_headNode->next, comp);
+	m_headNode->next = m_headNode->prev = m_headNode;
+	appendChain(first);
+	m_size += other.m_size;
+	other.m_headNode->next = other.m_headNode->prev = other.m_headNode;
+	other.m_size = 0;
 }
 
 template<class T, class Allocator>
 template <class Compare>
 void list<T, Allocator>::merge(list&& other, Compare comp)
 {
-	throw not_implemented();
+	merge(other, comp);
 }
 
 template<class T, class Allocator>
@@ -603,10 +1117,15 @@ void list<T, Allocator>::commonSplice(const_iterator pos, list& other)
 {
 	if (other.empty())
 		return;
-	node_type *posNode = pos.getNode();
-	node_type *beforePosNode = posNode->prev;
-	node_type *firstNode = other.begin().getNode();
-	node_type *lastNode = other.end().getNode()->prev;
+	if (!ListNodeTransfer<Allocator>::canRelinkAll(m_alloc, other.m_alloc))
+	{
+		transferNodes(pos, other, other.begin(), other.end());
+		return;
+	}
+	list_node_type *posNode = pos.getNode();
+	list_node_type *beforePosNode = posNode->prev;
+	list_node_type *firstNode = other.begin().getNode();
+	list_node_type *lastNode = other.end().getNode()->prev;
 	beforePosNode->next = firstNode;
 	firstNode->prev = beforePosNode;
 	posNode->prev = lastNode;
@@ -621,13 +1140,22 @@ void list<T, Allocator>::commonSplice(const_iterator pos, list& other)
 template<class T, class Allocator>
 void list<T, Allocator>::commonSplice(const_iterator pos, list& other, const_iterator it)
 {
-	node_type *itNode = it.getNode();
+	list_node_type *itNode = it.getNode();
+	if (this == &other && (pos.getNode() == itNode || pos.getNode() == itNode->next))
+		return;
+	if (!ListNodeTransfer<Allocator>::canRelink(m_alloc, other.m_alloc, itNode))
+	{
+		emplace(pos, std::move(itNode->val));
+		other.erase(it);
+		return;
+	}
+
 	itNode->prev->next = itNode->next;
 	itNode->next->prev = itNode->prev;
 	other.m_size--;
 
-	node_type *posNode = pos.getNode();
-	node_type *beforePosNode = posNode->prev;
+	list_node_type *posNode = pos.getNode();
+	list_node_type *beforePosNode = posNode->prev;
 	beforePosNode->next = itNode;
 	itNode->prev = beforePosNode;
 	posNode->prev = itNode;
@@ -638,15 +1166,34 @@ void list<T, Allocator>::commonSplice(const_iterator pos, list& other, const_ite
 template<class T, class Allocator>
 void list<T, Allocator>::commonSplice(const_iterator pos, list& other, const_iterator first, const_iterator last)
 {
-	// TODO: Replace to cyclic commonSplice(pos, other, it)
-	size_type size = 0;
+	if (first == last)
+		return;
+	if (!ListNodeTransfer<Allocator>::canRelinkAll(m_alloc, other.m_alloc))
+	{
+		transferNodes(pos, other, first, last);
+		return;
+	}
+	size_type count = 0;
 	for (const_iterator cur = first; cur != last; cur++)
-		size++;
+		count++;
+	commonSplice(pos, other, first, last, count);
+}
 
-	node_type *posNode = pos.getNode();
-	node_type *beforePosNode = posNode->prev;
-	node_type *firstNode = first.getNode();
-	node_type *lastNode = last.getNode()->prev;
+template<class T, class Allocator>
+void list<T, Allocator>::commonSplice(const_iterator pos, list& other, const_iterator first, const_iterator last, size_type count)
+{
+	if (first == last)
+		return;
+	if (!ListNodeTransfer<Allocator>::canRelinkAll(m_alloc, other.m_alloc))
+	{
+		transferNodes(pos, other, first, last);
+		return;
+	}
+
+	list_node_type *posNode = pos.getNode();
+	list_node_type *beforePosNode = posNode->prev;
+	list_node_type *firstNode = first.getNode();
+	list_node_type *lastNode = last.getNode()->prev;
 
 	firstNode->prev->next = lastNode->next;
 	lastNode->next->prev = firstNode->prev;
@@ -656,8 +1203,20 @@ void list<T, Allocator>::commonSplice(const_iterator pos, list& other, const_ite
 	posNode->prev = lastNode;
 	lastNode->next = posNode;
 
-	m_size += size;
-	other.m_size -= size;
+	m_size += count;
+	other.m_size -= count;
+}
+
+template<class T, class Allocator>
+void list<T, Allocator>::transferNodes(const_iterator pos, list& other, const_iterator first, const_iterator last)
+{
+	while (first != last)
+	{
+		const_iterator next = first;
+		++next;
+		commonSplice(pos, other, first);
+		first = next;
+	}
 }
 
 template<class T, class Allocator>
@@ -706,14 +1265,87 @@ template<class T, class Allocator>
 template<class UnaryPredicate>
 void list<T, Allocator>::remove_if(UnaryPredicate p)
 {
-	iterator cur = begin();
-	while (cur != end())
+	// Matching nodes are unlinked onto a detached chain and destroyed after
+	// the scan, so `value` in remove() may refer to an element of this list
+	list_node_type *head = m_headNode;
+	list_node_type *removed = nullptr;
+	list_node_type **removedTail = &removed;
+	ListPrefetcher<list_node_type> ahead(head->next, head);
+	try
 	{
-		if (p(*cur))
-			cur = erase(cur);
-		else
-			++cur;
+		for (list_node_type *node = head->next; node != head;)
+		{
+			ahead.advance();
+			list_node_type *next = node->next;
+			if (p(node->val))
+			{
+				node->prev->next = next;
+				next->prev = node->prev;
+				*removedTail = node;
+				removedTail = &node->next;
+			}
+			node = next;
+		}
+	}
+	catch (...)
+	{
+		*removedTail = nullptr;
+		m_size -= destroyChain(removed, nullptr);
+		throw;
 	}
+	*removedTail = nullptr;
+	m_size -= destroyChain(removed, nullptr);
+}
+
+template<class T, class Allocator>
+template<class UnaryPredicate>
+void list<T, Allocator>::remove_if(UnaryPredicate p, list& removed)
+{
+	if (this == &removed)
+		return;
+	if (!ListNodeTransfer<Allocator>::canRelinkAll(removed.m_alloc, m_alloc))
+	{
+		for (list_node_type *node = m_headNode->next; node != m_headNode;)
+		{
+			list_node_type *next = node->next;
+			if (p(node->val))
+				removed.commonSplice(removed.end(), *this, const_iterator(node));
+			node = next;
+		}
+		return;
+	}
+
+	// Matching nodes are moved straight onto the tail of `removed`
+	list_node_type *head = m_headNode;
+	list_node_type *removedTail = removed.m_headNode->prev;
+	ListPrefetcher<list_node_type> ahead(head->next, head);
+	try
+	{
+		for (list_node_type *node = head->next; node != head;)
+		{
+			ahead.advance();
+			list_node_type *next = node->next;
+			if (p(node->val))
+			{
+				node->prev->next = next;
+				next->prev = node->prev;
+				node->prev = removedTail;
+				removedTail->next = node;
+				removedTail = node;
+				m_size--;
+				removed.m_size++;
+			}
+			node = next;
+		}
+	}
+	catch (...)
+	{
+		removedTail->next = removed.m_headNode;
+		removed.m_headNode->prev = removedTail;
+		throw;
+	}
+	removedTail->next = removed.m_headNode;
+	removed.m_headNode->prev = removedTail;
 }
 
 template<class T, class Allocator>
@@ -721,11 +1353,13 @@ void list<T, Allocator>::reverse() noexcept
 {
 	if (empty())
 		return;
-	node_type* head = m_headNode;
-	node_type* cur = head;
+	list_node_type* head = m_headNode;
+	list_node_type* cur = head;
+	ListPrefetcher<list_node_type> ahead(head->next, head);
 	while (true)
 	{
-		node_type* next = cur->next;
+		ahead.advance();
+		list_node_type* next = cur->next;
 		cur->next = cur->prev;
 		cur->prev = next;
 		if (next == head)
@@ -735,36 +1369,75 @@ void list<T, Allocator>::reverse() noexcept
 }
 
 template<class T, class Allocator>
-void list<T, Allocator>::unique_equal(std::function<bool(const T& left, const T& right)> equalFunc)
+void list<T, Allocator>::unique()
 {
-	if (size() <= 2)
-		return;
-	auto itLeft = begin();
-	auto itRight = itLeft;
-	itRight++;
-	while (itRight != end())
-	{
-		while (itRight != end() && equalFunc(*itLeft, *itRight))
-			itRight = erase(itRight);
-		if (itRight != end())
-		{
-			++itLeft;
-			++itRight;
-		}
-	}
+	unique([](const T& left, const T& right) { return left == right; });
 }
 
 template<class T, class Allocator>
-void list<T, Allocator>::unique()
+template<class BinaryPredicate>
+void list<T, Allocator>::unique(BinaryPredicate p)
 {
-	unique_equal([](const T& left, const T& right) { return left == right; });
+	// Each run of duplicates following a kept node is unlinked as one
+	// sub-chain and freed in a single sweep
+	list_node_type *kept = m_headNode->next;
+	if (kept == m_headNode)
+		return;
+	ListPrefetcher<list_node_type> ahead(kept->next, m_headNode);
+	while (kept->next != m_headNode)
+	{
+		list_node_type *run = kept->next;
+		while (run != m_headNode && p(kept->val, run->val))
+		{
+			ahead.advance();
+			run = run->next;
+		}
+		if (run != kept->next)
+		{
+			list_node_type *first = kept->next;
+			kept->next = run;
+			run->prev = kept;
+			m_size -= destroyChain(first, run);
+		}
+		if (run == m_headNode)
+			break;
+		ahead.advance();
+		kept = run;
+	}
 }
 
 template<class T, class Allocator>
-template<class BinaryPredicate>
-void list<T, Allocator>::unique(BinaryPredicate p)
+template<class Hash, class KeyEqual>
+void list<T, Allocator>::unique_all(Hash hash, KeyEqual equal)
 {
-	unique_equal([&p](const T& left, const T& right) { return !p(left, right) && !p(right, left); });
+	// Keeps the first occurrence of every value; the later ones are pushed
+	// onto a detached chain that is freed once the scan is over
+	std::unordered_set<const T*, ListValueHash<T, Hash>, ListValueEqual<T, KeyEqual>> seen(m_size, ListValueHash<T, Hash> { hash }, ListValueEqual<T, KeyEqual> { equal });
+	list_node_type *removed = nullptr;
+	ListPrefetcher<list_node_type> ahead(m_headNode->next, m_headNode);
+	try
+	{
+		for (list_node_type *node = m_headNode->next; node != m_headNode;)
+		{
+			ahead.advance();
+			list_node_type *next = node->next;
+			if (!seen.insert(&node->val).second)
+			{
+				node->prev->next = next;
+				next->prev = node->prev;
+				node->next = removed;
+				removed = node;
+			}
+			node = next;
+		}
+	}
+	catch (...)
+	{
+		m_size -= destroyChain(removed, nullptr);
+		throw;
+	}
+	seen.clear();
+	m_size -= destroyChain(removed, nullptr);
 }
 
 template<class T, class Allocator>
@@ -777,84 +1450,262 @@ template<class T, class Allocator>
 template<class Compare>
 void list<T, Allocator>::sort(Compare comp)
 {
-	node_type* first = m_headNode->next;
-	node_type* last = m_headNode;
-	sort(first, last, comp);
+	if (size() < 2)
+		return;
+	m_headNode->prev->next = nullptr;
+	list_node_type *first = sortChain(m_headNode->next, m_size, comp);
+	m_headNode->next = m_headNode->prev = m_headNode;
+	appendChain(first);
 }
 
 template<class T, class Allocator>
-void list<T, Allocator>::sort(node_type*& first, node_type*& last, std::function<bool(const T& left, const T& right)> lessFunc)
+template<class KeyFn>
+void list<T, Allocator>::sort_by_key(KeyFn key)
 {
-	size_type size = 0;
-	node_type* cur = first;
-	while (cur != last)
+	if (size() < 2)
+		return;
+	// The chain is only relinked once every key is known, so a throwing key
+	// function leaves the list as it was
+	m_headNode->prev->next = nullptr;
+	list_node_type *first;
+	try
 	{
-		size++;
-		cur = cur->next;
+		first = sortChainByKey(m_headNode->next, m_size, key);
 	}
-	if (size < 2)
-		return;
-	cur = first;
-	for (size_t i = 0; i < size / 2; i++)
-		cur = cur->next;
-	sort(first, cur, lessFunc);
-	sort(cur, last, lessFunc);
+	catch (...)
+	{
+		m_headNode->prev->next = m_headNode;
+		throw;
+	}
+	m_headNode->next = m_headNode->prev = m_headNode;
+	appendChain(first);
+}
 
-	node_type *nodeBeforeInterval = first->prev;
-	node_type *nodeAfterInterval = last;
-	node_type *leftCurrent = first;
-	node_type *rightCurrent = cur;
-	node_type *lastSucceed = leftCurrent->prev;
+template<class T, class Allocator>
+template<class UnaryPredicate>
+typename list<T, Allocator>::iterator list<T, Allocator>::partition(UnaryPredicate p)
+{
+	// Relinking keeps the order for free, so both partitions are stable
+	return stable_partition(p);
+}
 
-	lastSucceed->next = nullptr;
-	rightCurrent->prev->next = nullptr;
-	nodeAfterInterval->prev->next = nullptr;
+template<class T, class Allocator>
+template<class UnaryPredicate>
+typename list<T, Allocator>::iterator list<T, Allocator>::stable_partition(UnaryPredicate p)
+{
+	// Rejected nodes are moved onto a detached chain which is appended after
+	// the scan; if the predicate throws, it is appended all the same
+	list_node_type *head = m_headNode;
+	list_node_type *rejected = nullptr;
+	list_node_type **rejectedTail = &rejected;
+	ListPrefetcher<list_node_type> ahead(head->next, head);
+	try
+	{
+		for (list_node_type *node = head->next; node != head;)
+		{
+			ahead.advance();
+			list_node_type *next = node->next;
+			if (!p(node->val))
+			{
+				node->prev->next = next;
+				next->prev = node->prev;
+				*rejectedTail = node;
+				rejectedTail = &node->next;
+			}
+			node = next;
+		}
+	}
+	catch (...)
+	{
+		*rejectedTail = nullptr;
+		appendChain(rejected);
+		throw;
+	}
+	*rejectedTail = nullptr;
+	appendChain(rejected);
+	return iterator(rejected != nullptr ? rejected : head);
+}
 
-	while (leftCurrent != nullptr || rightCurrent != nullptr)
+template<class T, class Allocator>
+void list<T, Allocator>::set_union(list& other)
+{
+	set_union(other, [](const T& left, const T& right) { return left < right; });
+}
+
+template<class T, class Allocator>
+void list<T, Allocator>::set_union(list&& other)
+{
+	set_union(other);
+}
+
+template<class T, class Allocator>
+template<class Compare>
+void list<T, Allocator>::set_union(list& other, Compare comp)
+{
+	// Elements of other without an equivalent here are spliced in; the
+	// matched ones stay behind in other
+	if (this == &other)
+		return;
+	const_iterator it = cbegin();
+	const_iterator otherIt = other.cbegin();
+	while (otherIt != other.cend())
 	{
-		if (leftCurrent == nullptr)
+		if (it == cend())
 		{
-			rightCurrent->prev = lastSucceed;
-			lastSucceed->next = rightCurrent;
-			lastSucceed = rightCurrent;
-			rightCurrent = rightCurrent->next;
+			commonSplice(it, other, otherIt, other.cend());
+			break;
 		}
-		else
-		if (rightCurrent == nullptr)
+		if (comp(*otherIt, *it))
 		{
-			leftCurrent->prev = lastSucceed;
-			lastSucceed->next = leftCurrent;
-			lastSucceed = leftCurrent;
-			leftCurrent = leftCurrent->next;
+			const_iterator next = std::next(otherIt);
+			commonSplice(it, other, otherIt);
+			otherIt = next;
 		}
 		else
-		if (lessFunc(leftCurrent->val, rightCurrent->val))
 		{
-			leftCurrent->prev = lastSucceed;
-			lastSucceed->next = leftCurrent;
-			lastSucceed = leftCurrent;
-			leftCurrent = leftCurrent->next;
+			if (!comp(*it, *otherIt))
+				++otherIt;
+			++it;
 		}
-		else
+	}
+}
+
+template<class T, class Allocator>
+template<class Compare>
+void list<T, Allocator>::set_union(list&& other, Compare comp)
+{
+	set_union(other, comp);
+}
+
+template<class T, class Allocator>
+void list<T, Allocator>::set_intersection(const list& other)
+{
+	set_intersection(other, [](const T& left, const T& right) { return left < right; });
+}
+
+template<class T, class Allocator>
+template<class Compare>
+void list<T, Allocator>::set_intersection(const list& other, Compare comp)
+{
+	if (this == &other)
+		return;
+	list_node_type *removed = nullptr;
+	list_node_type **removedTail = &removed;
+	list_node_type *node = m_headNode->next;
+	const list_node_type *otherNode = other.m_headNode->next;
+	try
+	{
+		while (node != m_headNode)
 		{
-			rightCurrent->prev = lastSucceed;
-			lastSucceed->next = rightCurrent;
-			lastSucceed = rightCurrent;
-			rightCurrent = rightCurrent->next;
+			list_node_type *next = node->next;
+			if (otherNode != other.m_headNode && !comp(node->val, otherNode->val))
+			{
+				bool matched = !comp(otherNode->val, node->val);
+				otherNode = otherNode->next;
+				if (!matched)
+					continue;
+			}
+			else
+			{
+				node->prev->next = next;
+				next->prev = node->prev;
+				*removedTail = node;
+				removedTail = &node->next;
+			}
+			node = next;
 		}
 	}
+	catch (...)
+	{
+		*removedTail = nullptr;
+		m_size -= destroyChain(removed, nullptr);
+		throw;
+	}
+	*removedTail = nullptr;
+	m_size -= destroyChain(removed, nullptr);
+}
 
-	lastSucceed->next = nodeAfterInterval;
-	nodeAfterInterval->prev = lastSucceed;
+template<class T, class Allocator>
+void list<T, Allocator>::set_difference(const list& other)
+{
+	set_difference(other, [](const T& left, const T& right) { return left < right; });
+}
 
-	first = nodeBeforeInterval->next;
-	last = nodeAfterInterval;
+template<class T, class Allocator>
+template<class Compare>
+void list<T, Allocator>::set_difference(const list& other, Compare comp)
+{
+	if (this == &other)
+	{
+		clear();
+		return;
+	}
+	list_node_type *removed = nullptr;
+	list_node_type **removedTail = &removed;
+	list_node_type *node = m_headNode->next;
+	const list_node_type *otherNode = other.m_headNode->next;
+	try
+	{
+		while (node != m_headNode && otherNode != other.m_headNode)
+		{
+			list_node_type *next = node->next;
+			if (comp(node->val, otherNode->val))
+			{
+				node = next;
+				continue;
+			}
+			bool matched = !comp(otherNode->val, node->val);
+			otherNode = otherNode->next;
+			if (matched)
+			{
+				node->prev->next = next;
+				next->prev = node->prev;
+				*removedTail = node;
+				removedTail = &node->next;
+				node = next;
+			}
+		}
+	}
+	catch (...)
+	{
+		*removedTail = nullptr;
+		m_size -= destroyChain(removed, nullptr);
+		throw;
+	}
+	*removedTail = nullptr;
+	m_size -= destroyChain(removed, nullptr);
+}
+
+template<class T, class Allocator>
+template<class UnaryFunction>
+UnaryFunction list<T, Allocator>::for_each_prefetched(UnaryFunction f, size_type distance)
+{
+	ListPrefetcher<list_node_type> ahead(m_headNode->next, m_headNode, distance);
+	for (list_node_type* cur = m_headNode->next; cur != m_headNode; cur = cur->next)
+	{
+		ahead.advance();
+		f(cur->val);
+	}
+	return f;
+}
+
+template<class T, class Allocator>
+template<class UnaryFunction>
+UnaryFunction list<T, Allocator>::for_each_prefetched(UnaryFunction f, size_type distance) const
+{
+	ListPrefetcher<list_node_type> ahead(m_headNode->next, m_headNode, distance);
+	for (const list_node_type* cur = m_headNode->next; cur != m_headNode; cur = cur->next)
+	{
+		ahead.advance();
+		f(cur->val);
+	}
+	return f;
 }
 
 template<class T, class Allocator>
 ListNode<typename list<T, Allocator>::value_type>* list<T, Allocator>::allocateNode(ListNode<value_type>* prev, ListNode<value_type>* next)
 {
-	auto nodeAlloc = node_allocator_type();
+	node_allocator_type nodeAlloc(m_alloc);
 	ListNode<value_type> *res = std::allocator_traits<node_allocator_type>::allocate(nodeAlloc, 1);
 	res->next = next;
 	res->prev = prev;
@@ -878,16 +1729,56 @@ ListNode<typename list<T, Allocator>::value_type>* list<T, Allocator>::insertNod
 	return node;
 }
 
+template<class T, class Allocator>
+void list<T, Allocator>::attachNode(ListNode<value_type>* node, ListNode<value_type>* next)
+{
+	node->next = next;
+	node->prev = next->prev;
+	next->prev->next = node;
+	next->prev = node;
+	m_size++;
+}
+
 template<class T, class Allocator>
 ListNode<typename list<T, Allocator>::value_type>* list<T, Allocator>::destroyNode(ListNode<value_type>* node)
 {
-	auto nodeAlloc = node_allocator_type();
+	node_allocator_type nodeAlloc(m_alloc);
 	std::allocator_traits<Allocator>::destroy(m_alloc, &node->val);
 	ListNode<value_type>* res = node->next;
 	std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
 	return res;
 }
 
+template<class T, class Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::destroyChain(ListNode<value_type>* first, ListNode<value_type>* last)
+{
+	node_allocator_type nodeAlloc(m_alloc);
+	size_type count = 0;
+	while (first != last)
+	{
+		ListNode<value_type>* next = first->next;
+		std::allocator_traits<Allocator>::destroy(m_alloc, &first->val);
+		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, first, 1);
+		first = next;
+		count++;
+	}
+	return count;
+}
+
+template<class T, class Allocator>
+void list<T, Allocator>::appendChain(ListNode<value_type>* first)
+{
+	ListNode<value_type> *prev = m_headNode->prev;
+	for (ListNode<value_type> *node = first; node != nullptr; node = node->next)
+	{
+		node->prev = prev;
+		prev->next = node;
+		prev = node;
+	}
+	prev->next = m_headNode;
+	m_headNode->prev = prev;
+}
+
 template<class T, class Allocator>
 bool operator==(const list<T, Allocator>& left, const list<T, Allocator>& right)
 {
@@ -895,8 +1786,12 @@ bool operator==(const list<T, Allocator>& left, const list<T, Allocator>& right)
 		return false;
 	auto itLeft = left.begin();
 	auto itRight = right.begin();
+	ListPrefetcher<ListNode<T>> leftAhead(itLeft.getNode(), left.end().getNode());
+	ListPrefetcher<ListNode<T>> rightAhead(itRight.getNode(), right.end().getNode());
 	while (itLeft != left.end() && itRight != right.end())
 	{
+		leftAhead.advance();
+		rightAhead.advance();
 		if (*itLeft != *itRight)
 			return false;
 		++itLeft;
@@ -916,8 +1811,12 @@ bool operator<(const list<T, Allocator>& left, const list<T, Allocator>& right)
 {
 	auto itLeft = left.begin();
 	auto itRight = right.begin();
+	ListPrefetcher<ListNode<T>> leftAhead(itLeft.getNode(), left.end().getNode());
+	ListPrefetcher<ListNode<T>> rightAhead(itRight.getNode(), right.end().getNode());
 	while (itLeft != left.end() && itRight != right.end())
 	{
+		leftAhead.advance();
+		rightAhead.advance();
 		if (*itLeft < *itRight)
 			return true;
 		if (*itRight < *itLeft)
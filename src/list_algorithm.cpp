@@ -0,0 +1,257 @@
+#include "../include/list_algorithm.h"
+
+namespace blk
+{
+
+template<class Task>
+void parallelRun(size_t tasks, size_t threads, Task task)
+{
+	threads = std::max<size_t>(1, std::min(threads, tasks));
+	std::atomic<size_t> next(0);
+	std::exception_ptr error;
+	std::mutex errorMutex;
+	auto worker = [&]()
+	{
+		for (size_t i = next++; i < tasks; i = next++)
+		{
+			try
+			{
+				task(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(errorMutex);
+				if (!error)
+					error = std::current_exception();
+				next = tasks;
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(threads - 1);
+	for (size_t i = 1; i < threads; i++)
+	{
+		try
+		{
+			workers.emplace_back(worker);
+		}
+		catch (const std::system_error&)
+		{
+			// Fewer workers just means more tasks for each of them
+			break;
+		}
+	}
+	worker();
+	for (std::thread& thread : workers)
+		thread.join();
+	if (error)
+		std::rethrow_exception(error);
+}
+
+template<class List, class Range>
+void merge_all(List& destination, Range& lists)
+{
+	merge_all(destination, lists, [](const typename List::value_type& left, const typename List::value_type& right) { return left < right; });
+}
+
+template<class List, class Range, class Compare>
+void merge_all(List& destination, Range& lists, Compare comp)
+{
+	struct Source
+	{
+		List *list;
+		size_t index;
+	};
+
+	std::vector<Source> heap;
+	for (auto& input : lists)
+		if (&input != &destination && !input.empty())
+			heap.push_back(Source { &input, heap.size() });
+	// Max-heap on "comes later", so the top is the smallest front element;
+	// ties go to the list that appears first in the range
+	auto later = [&comp](const Source& left, const Source& right)
+	{
+		if (comp(right.list->front(), left.list->front()))
+			return true;
+		if (comp(left.list->front(), right.list->front()))
+			return false;
+		return left.index > right.index;
+	};
+	std::make_heap(heap.begin(), heap.end(), later);
+
+	auto pos = destination.cbegin();
+	while (!heap.empty())
+	{
+		std::pop_heap(heap.begin(), heap.end(), later);
+		Source& top = heap.back();
+		// Keep taking from the same list while it still holds the smallest
+		// element, which saves heap operations on clustered inputs
+		do
+		{
+			while (pos != destination.cend() && !comp(top.list->front(), *pos))
+				++pos;
+			destination.splice(pos, *top.list, top.list->cbegin());
+		} while (!top.list->empty() && (heap.size() == 1 || !later(top, heap.front())));
+
+		if (top.list->empty())
+			heap.pop_back();
+		else
+			std::push_heap(heap.begin(), heap.end(), later);
+	}
+}
+
+template<class T, class Allocator, class Range, class Compare>
+void merge_all(list<T, Allocator>& destination, Range& lists, Compare comp, size_t threads)
+{
+	using list_type = list<T, Allocator>;
+
+	size_t total = destination.size();
+	for (auto& input : lists)
+		if (&input != &destination)
+			total += input.size();
+	threads = workerCount(threads);
+	if (threads < 2 || total < threads * 1024)
+	{
+		merge_all(destination, lists, comp);
+		return;
+	}
+
+	std::vector<list_type*> inputs;
+	list_type own(destination.get_allocator());
+	own.splice(own.end(), destination);
+	inputs.push_back(&own);
+	for (auto& input : lists)
+		if (&input != &destination)
+			inputs.push_back(&input);
+
+	std::vector<std::vector<list_type>> parts(threads);
+	std::vector<list_type> merged;
+	merged.reserve(threads);
+	for (size_t p = 0; p < threads; p++)
+	{
+		merged.emplace_back(destination.get_allocator());
+		parts[p].reserve(inputs.size());
+		for (list_type *input : inputs)
+			parts[p].emplace_back(input->get_allocator());
+	}
+
+	try
+	{
+		// Sample every step-th element so that each list contributes in
+		// proportion to its size; samples point into the nodes, which are
+		// only ever relinked from here on
+		const size_t step = std::max<size_t>(1, total / (threads * 64));
+		std::vector<std::vector<const T*>> samples(inputs.size());
+		parallelRun(inputs.size(), threads, [&](size_t i)
+		{
+			size_t index = 0;
+			for (auto it = inputs[i]->cbegin(); it != inputs[i]->cend(); ++it, ++index)
+				if (index % step == step / 2)
+					samples[i].push_back(&*it);
+		});
+		std::vector<const T*> splitters;
+		for (auto& s : samples)
+			splitters.insert(splitters.end(), s.begin(), s.end());
+		std::sort(splitters.begin(), splitters.end(), [&comp](const T* left, const T* right) { return comp(*left, *right); });
+		std::vector<const T*> bounds(threads - 1);
+		for (size_t p = 0; p + 1 < threads; p++)
+			bounds[p] = splitters.empty() ? nullptr : splitters[(p + 1) * splitters.size() / threads];
+
+		// Equivalent elements compare the same way against every bound, so
+		// they all land in one key range and the merge stays stable
+		parallelRun(inputs.size(), threads, [&](size_t i)
+		{
+			list_type& input = *inputs[i];
+			for (size_t p = 0; p + 1 < threads; p++)
+			{
+				auto last = input.cbegin();
+				while (bounds[p] != nullptr && last != input.cend() && comp(*last, *bounds[p]))
+					++last;
+				parts[p][i].splice(parts[p][i].end(), input, input.cbegin(), last);
+			}
+			parts[threads - 1][i].splice(parts[threads - 1][i].end(), input);
+		});
+
+		parallelRun(threads, threads, [&](size_t p)
+		{
+			merge_all(merged[p], parts[p], comp);
+		});
+	}
+	catch (...)
+	{
+		for (list_type& m : merged)
+			destination.splice(destination.end(), m);
+		for (auto& range : parts)
+			for (list_type& part : range)
+				destination.splice(destination.end(), part);
+		for (list_type *input : inputs)
+			destination.splice(destination.end(), *input);
+		throw;
+	}
+
+	for (list_type& m : merged)
+		destination.splice(destination.end(), m);
+}
+
+
+template<class Iterator>
+std::vector<Iterator> chunkBounds(Iterator first, size_t size, size_t chunks)
+{
+	chunks = std::max<size_t>(1, std::min(chunks, size));
+	std::vector<Iterator> bounds;
+	bounds.reserve(chunks + 1);
+	bounds.push_back(first);
+	for (size_t c = 0; c < chunks; c++)
+	{
+		size_t count = size / chunks + (c < size % chunks ? 1 : 0);
+		for (size_t i = 0; i < count; i++)
+			++first;
+		bounds.push_back(first);
+	}
+	return bounds;
+}
+
+inline size_t workerCount(size_t threads)
+{
+	if (threads == 0)
+		threads = std::thread::hardware_concurrency();
+	return std::max<size_t>(1, threads);
+}
+
+template<class List, class UnaryFunction>
+void parallel_for_each(List& list, UnaryFunction f, size_t threads)
+{
+	if (list.empty())
+		return;
+	threads = workerCount(threads);
+	auto bounds = chunkBounds(list.begin(), list.size(), threads * 4);
+	parallelRun(bounds.size() - 1, threads, [&](size_t c)
+	{
+		for (auto it = bounds[c]; it != bounds[c + 1]; ++it)
+			f(*it);
+	});
+}
+
+template<class List, class T, class BinaryReduce, class UnaryTransform>
+T parallel_transform_reduce(const List& list, T init, BinaryReduce reduce, UnaryTransform transform, size_t threads)
+{
+	if (list.empty())
+		return init;
+	threads = workerCount(threads);
+	auto bounds = chunkBounds(list.begin(), list.size(), threads * 4);
+	std::vector<T> partials(bounds.size() - 1, init);
+	parallelRun(bounds.size() - 1, threads, [&](size_t c)
+	{
+		auto it = bounds[c];
+		T acc = transform(*it);
+		for (++it; it != bounds[c + 1]; ++it)
+			acc = reduce(std::move(acc), transform(*it));
+		partials[c] = std::move(acc);
+	});
+	for (T& partial : partials)
+		init = reduce(std::move(init), std::move(partial));
+	return init;
+}
+
+}
@@ -0,0 +1,172 @@
+#include "../include/list_io.h"
+
+namespace blk
+{
+
+inline void writeListBytes(std::ostream& out, const void* data, size_t bytes)
+{
+	if (!out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes)))
+		throw std::runtime_error("blk::save: write failed");
+}
+
+inline void readListBytes(std::istream& in, void* data, size_t bytes)
+{
+	if (!in.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes)))
+		throw std::runtime_error("blk::load: unexpected end of input");
+}
+
+inline void writeListHeader(std::ostream& out, std::uint32_t elementSize, std::uint64_t count)
+{
+	ListStreamHeader header;
+	std::memcpy(header.magic, "BLKLIST", sizeof(header.magic));
+	header.version = ListStreamHeader::currentVersion;
+	header.byteOrder = ListStreamHeader::byteOrderMark;
+	header.elementSize = elementSize;
+	header.reserved = 0;
+	header.count = count;
+	writeListBytes(out, &header, sizeof(header));
+}
+
+inline std::uint64_t readListHeader(std::istream& in, std::uint32_t elementSize)
+{
+	ListStreamHeader header;
+	readListBytes(in, &header, sizeof(header));
+	if (std::memcmp(header.magic, "BLKLIST", sizeof(header.magic)) != 0)
+		throw std::runtime_error("blk::load: input is not a serialized list");
+	if (header.version != ListStreamHeader::currentVersion)
+		throw std::runtime_error("blk::load: unsupported format version");
+	if (header.byteOrder != ListStreamHeader::byteOrderMark)
+		throw std::runtime_error("blk::load: input was written with a different byte order");
+	if (header.elementSize != elementSize)
+		throw std::runtime_error("blk::load: element size or encoding does not match");
+	return header.count;
+}
+
+template<class T>
+size_t listChunkElements()
+{
+	return sizeof(T) < BLK_LIST_IO_CHUNK_BYTES ? BLK_LIST_IO_CHUNK_BYTES / sizeof(T) : 1;
+}
+
+// Reads the chunk counts that follow the header and lets readChunk(count)
+// consume each chunk's elements
+template<class List, class ReadChunk>
+void loadListChunks(List& list, std::istream& in, std::uint64_t count, ReadChunk readChunk)
+{
+	list.clear();
+	try
+	{
+		std::uint64_t total = 0;
+		for (;;)
+		{
+			std::uint32_t chunk;
+			readListBytes(in, &chunk, sizeof(chunk));
+			if (chunk == 0)
+				break;
+			total += chunk;
+			if (total > count)
+				throw std::runtime_error("blk::load: chunks hold more elements than the header");
+			readChunk(chunk);
+		}
+		if (total != count)
+			throw std::runtime_error("blk::load: chunks hold fewer elements than the header");
+	}
+	catch (...)
+	{
+		list.clear();
+		throw;
+	}
+}
+
+template<class List>
+void save(const List& list, std::ostream& out)
+{
+	using T = typename List::value_type;
+	static_assert(std::is_trivially_copyable<T>::value, "save without a writer requires a trivially copyable element type");
+
+	const size_t capacity = listChunkElements<T>();
+	std::unique_ptr<unsigned char[]> buffer(new unsigned char[capacity * sizeof(T) + sizeof(std::uint32_t)]);
+	// The chunk's element count is written together with its payload
+	unsigned char *payload = buffer.get() + sizeof(std::uint32_t);
+
+	writeListHeader(out, sizeof(T), list.size());
+	auto it = list.begin();
+	size_t remaining = list.size();
+	while (remaining > 0)
+	{
+		std::uint32_t chunk = static_cast<std::uint32_t>(remaining < capacity ? remaining : capacity);
+		std::memcpy(buffer.get(), &chunk, sizeof(chunk));
+		for (std::uint32_t i = 0; i < chunk; ++i, ++it)
+			std::memcpy(payload + i * sizeof(T), &*it, sizeof(T));
+		writeListBytes(out, buffer.get(), sizeof(chunk) + chunk * sizeof(T));
+		remaining -= chunk;
+	}
+	const std::uint32_t last = 0;
+	writeListBytes(out, &last, sizeof(last));
+}
+
+template<class List, class Writer>
+void save(const List& list, std::ostream& out, Writer writer)
+{
+	using T = typename List::value_type;
+
+	const size_t capacity = listChunkElements<T>();
+	writeListHeader(out, 0, list.size());
+	auto it = list.begin();
+	size_t remaining = list.size();
+	while (remaining > 0)
+	{
+		std::uint32_t chunk = static_cast<std::uint32_t>(remaining < capacity ? remaining : capacity);
+		writeListBytes(out, &chunk, sizeof(chunk));
+		for (std::uint32_t i = 0; i < chunk; ++i, ++it)
+			writer(out, *it);
+		if (!out)
+			throw std::runtime_error("blk::save: write failed");
+		remaining -= chunk;
+	}
+	const std::uint32_t last = 0;
+	writeListBytes(out, &last, sizeof(last));
+}
+
+template<class List>
+void load(List& list, std::istream& in)
+{
+	using T = typename List::value_type;
+	using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+	static_assert(std::is_trivially_copyable<T>::value, "load without a reader requires a trivially copyable element type");
+
+	list.clear();
+	std::uint64_t count = readListHeader(in, sizeof(T));
+	const size_t capacity = listChunkElements<T>();
+	std::unique_ptr<Storage[]> buffer(new Storage[capacity]);
+	loadListChunks(list, in, count, [&](std::uint32_t chunk)
+	{
+		// Chunks written with a larger buffer are read in several pieces
+		while (chunk > 0)
+		{
+			size_t piece = chunk < capacity ? chunk : capacity;
+			readListBytes(in, buffer.get(), piece * sizeof(T));
+			const T* first = reinterpret_cast<const T*>(buffer.get());
+			list.insert(list.end(), first, first + piece);
+			chunk -= static_cast<std::uint32_t>(piece);
+		}
+	});
+}
+
+template<class List, class Reader>
+void load(List& list, std::istream& in, Reader reader)
+{
+	list.clear();
+	std::uint64_t count = readListHeader(in, 0);
+	loadListChunks(list, in, count, [&](std::uint32_t chunk)
+	{
+		for (; chunk > 0; --chunk)
+		{
+			list.push_back(reader(in));
+			if (!in)
+				throw std::runtime_error("blk::load: unexpected end of input");
+		}
+	});
+}
+
+}
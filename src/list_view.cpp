@@ -0,0 +1,471 @@
+#include "../include/list_view.h"
+
+namespace blk
+{
+
+// ListRefView implementation
+
+template<class Container>
+ListRefView<Container>::ListRefView(Container& container) noexcept : m_container(&container) {}
+
+template<class Container>
+typename ListRefView<Container>::iterator ListRefView<Container>::begin() const
+{
+	return m_container->begin();
+}
+
+template<class Container>
+typename ListRefView<Container>::iterator ListRefView<Container>::end() const
+{
+	return m_container->end();
+}
+
+// ListSubrange implementation
+
+template<class Iterator>
+ListSubrange<Iterator>::ListSubrange() : m_first(), m_last() {}
+
+template<class Iterator>
+ListSubrange<Iterator>::ListSubrange(Iterator first, Iterator last) : m_first(first), m_last(last) {}
+
+template<class Iterator>
+typename ListSubrange<Iterator>::iterator ListSubrange<Iterator>::begin() const
+{
+	return m_first;
+}
+
+template<class Iterator>
+typename ListSubrange<Iterator>::iterator ListSubrange<Iterator>::end() const
+{
+	return m_last;
+}
+
+template<class Iterator>
+bool ListSubrange<Iterator>::empty() const
+{
+	return m_first == m_last;
+}
+
+template<class Iterator>
+size_t ListSubrange<Iterator>::size() const
+{
+	return static_cast<size_t>(std::distance(m_first, m_last));
+}
+
+// ListFilterIterator implementation
+
+template<class Iterator, class Predicate>
+ListFilterIterator<Iterator, Predicate>::ListFilterIterator() : m_it(), m_last(), m_pred(nullptr) {}
+
+template<class Iterator, class Predicate>
+ListFilterIterator<Iterator, Predicate>::ListFilterIterator(Iterator it, Iterator last, const Predicate* pred) :
+	m_it(it),
+	m_last(last),
+	m_pred(pred)
+{
+	skip();
+}
+
+template<class Iterator, class Predicate>
+bool ListFilterIterator<Iterator, Predicate>::operator==(const ListFilterIterator& it) const
+{
+	return m_it == it.m_it;
+}
+
+template<class Iterator, class Predicate>
+bool ListFilterIterator<Iterator, Predicate>::operator!=(const ListFilterIterator& it) const
+{
+	return !(*this == it);
+}
+
+template<class Iterator, class Predicate>
+ListFilterIterator<Iterator, Predicate>& ListFilterIterator<Iterator, Predicate>::operator++()
+{
+	++m_it;
+	skip();
+	return *this;
+}
+
+template<class Iterator, class Predicate>
+ListFilterIterator<Iterator, Predicate> ListFilterIterator<Iterator, Predicate>::operator++(int)
+{
+	ListFilterIterator res(*this);
+	++*this;
+	return res;
+}
+
+template<class Iterator, class Predicate>
+typename ListFilterIterator<Iterator, Predicate>::reference ListFilterIterator<Iterator, Predicate>::operator*() const
+{
+	// List iterators only dereference to mutable elements when non-const
+	Iterator it = m_it;
+	return *it;
+}
+
+template<class Iterator, class Predicate>
+void ListFilterIterator<Iterator, Predicate>::skip()
+{
+	while (m_it != m_last && !(*m_pred)(*m_it))
+		++m_it;
+}
+
+// ListTransformIterator implementation
+
+template<class Iterator, class Function>
+ListTransformIterator<Iterator, Function>::ListTransformIterator() : m_it(), m_fn(nullptr) {}
+
+template<class Iterator, class Function>
+ListTransformIterator<Iterator, Function>::ListTransformIterator(Iterator it, const Function* fn) : m_it(it), m_fn(fn) {}
+
+template<class Iterator, class Function>
+bool ListTransformIterator<Iterator, Function>::operator==(const ListTransformIterator& it) const
+{
+	return m_it == it.m_it;
+}
+
+template<class Iterator, class Function>
+bool ListTransformIterator<Iterator, Function>::operator!=(const ListTransformIterator& it) const
+{
+	return !(*this == it);
+}
+
+template<class Iterator, class Function>
+ListTransformIterator<Iterator, Function>& ListTransformIterator<Iterator, Function>::operator++()
+{
+	++m_it;
+	return *this;
+}
+
+template<class Iterator, class Function>
+ListTransformIterator<Iterator, Function> ListTransformIterator<Iterator, Function>::operator++(int)
+{
+	ListTransformIterator res(*this);
+	++m_it;
+	return res;
+}
+
+template<class Iterator, class Function>
+typename ListTransformIterator<Iterator, Function>::reference ListTransformIterator<Iterator, Function>::operator*() const
+{
+	Iterator it = m_it;
+	return (*m_fn)(*it);
+}
+
+// ListTakeWhileIterator implementation
+
+template<class Iterator, class Predicate>
+ListTakeWhileIterator<Iterator, Predicate>::ListTakeWhileIterator() : m_it(), m_last(), m_pred(nullptr) {}
+
+template<class Iterator, class Predicate>
+ListTakeWhileIterator<Iterator, Predicate>::ListTakeWhileIterator(Iterator it, Iterator last, const Predicate* pred) :
+	m_it(it),
+	m_last(last),
+	m_pred(pred)
+{
+	check();
+}
+
+template<class Iterator, class Predicate>
+bool ListTakeWhileIterator<Iterator, Predicate>::operator==(const ListTakeWhileIterator& it) const
+{
+	return m_it == it.m_it;
+}
+
+template<class Iterator, class Predicate>
+bool ListTakeWhileIterator<Iterator, Predicate>::operator!=(const ListTakeWhileIterator& it) const
+{
+	return !(*this == it);
+}
+
+template<class Iterator, class Predicate>
+ListTakeWhileIterator<Iterator, Predicate>& ListTakeWhileIterator<Iterator, Predicate>::operator++()
+{
+	++m_it;
+	check();
+	return *this;
+}
+
+template<class Iterator, class Predicate>
+ListTakeWhileIterator<Iterator, Predicate> ListTakeWhileIterator<Iterator, Predicate>::operator++(int)
+{
+	ListTakeWhileIterator res(*this);
+	++*this;
+	return res;
+}
+
+template<class Iterator, class Predicate>
+typename ListTakeWhileIterator<Iterator, Predicate>::reference ListTakeWhileIterator<Iterator, Predicate>::operator*() const
+{
+	Iterator it = m_it;
+	return *it;
+}
+
+template<class Iterator, class Predicate>
+void ListTakeWhileIterator<Iterator, Predicate>::check()
+{
+	// The first rejected element ends the view, so jump straight to the end
+	if (m_it != m_last && !(*m_pred)(*m_it))
+		m_it = m_last;
+}
+
+// ListChunkIterator implementation
+
+template<class Iterator>
+ListChunkIterator<Iterator>::ListChunkIterator() : m_it(), m_next(), m_last(), m_count(0) {}
+
+template<class Iterator>
+ListChunkIterator<Iterator>::ListChunkIterator(Iterator it, Iterator last, size_t count) :
+	m_it(it),
+	m_next(it),
+	m_last(last),
+	m_count(count)
+{
+	m_next = chunkEnd();
+}
+
+template<class Iterator>
+bool ListChunkIterator<Iterator>::operator==(const ListChunkIterator& it) const
+{
+	return m_it == it.m_it;
+}
+
+template<class Iterator>
+bool ListChunkIterator<Iterator>::operator!=(const ListChunkIterator& it) const
+{
+	return !(*this == it);
+}
+
+template<class Iterator>
+ListChunkIterator<Iterator>& ListChunkIterator<Iterator>::operator++()
+{
+	m_it = m_next;
+	m_next = chunkEnd();
+	return *this;
+}
+
+template<class Iterator>
+ListChunkIterator<Iterator> ListChunkIterator<Iterator>::operator++(int)
+{
+	ListChunkIterator res(*this);
+	++*this;
+	return res;
+}
+
+template<class Iterator>
+typename ListChunkIterator<Iterator>::reference ListChunkIterator<Iterator>::operator*() const
+{
+	return ListSubrange<Iterator>(m_it, m_next);
+}
+
+template<class Iterator>
+Iterator ListChunkIterator<Iterator>::chunkEnd() const
+{
+	Iterator res = m_it;
+	for (size_t i = 0; i < m_count && res != m_last; i++)
+		++res;
+	return res;
+}
+
+// ListZipIterator implementation
+
+template<class Iterator1, class Iterator2>
+ListZipIterator<Iterator1, Iterator2>::ListZipIterator() : m_first(), m_firstLast(), m_second(), m_secondLast() {}
+
+template<class Iterator1, class Iterator2>
+ListZipIterator<Iterator1, Iterator2>::ListZipIterator(Iterator1 first, Iterator1 firstLast, Iterator2 second, Iterator2 secondLast) :
+	m_first(first),
+	m_firstLast(firstLast),
+	m_second(second),
+	m_secondLast(secondLast)
+{
+	check();
+}
+
+template<class Iterator1, class Iterator2>
+bool ListZipIterator<Iterator1, Iterator2>::operator==(const ListZipIterator& it) const
+{
+	return m_first == it.m_first && m_second == it.m_second;
+}
+
+template<class Iterator1, class Iterator2>
+bool ListZipIterator<Iterator1, Iterator2>::operator!=(const ListZipIterator& it) const
+{
+	return !(*this == it);
+}
+
+template<class Iterator1, class Iterator2>
+ListZipIterator<Iterator1, Iterator2>& ListZipIterator<Iterator1, Iterator2>::operator++()
+{
+	++m_first;
+	++m_second;
+	check();
+	return *this;
+}
+
+template<class Iterator1, class Iterator2>
+ListZipIterator<Iterator1, Iterator2> ListZipIterator<Iterator1, Iterator2>::operator++(int)
+{
+	ListZipIterator res(*this);
+	++*this;
+	return res;
+}
+
+template<class Iterator1, class Iterator2>
+typename ListZipIterator<Iterator1, Iterator2>::reference ListZipIterator<Iterator1, Iterator2>::operator*() const
+{
+	Iterator1 first = m_first;
+	Iterator2 second = m_second;
+	return reference(*first, *second);
+}
+
+template<class Iterator1, class Iterator2>
+void ListZipIterator<Iterator1, Iterator2>::check()
+{
+	// Once either range is exhausted both sides move to their ends, so the
+	// iterator compares equal to end()
+	if (m_first == m_firstLast || m_second == m_secondLast)
+	{
+		m_first = m_firstLast;
+		m_second = m_secondLast;
+	}
+}
+
+// ListFilterView implementation
+
+template<class Base, class Predicate>
+ListFilterView<Base, Predicate>::ListFilterView(Base base, Predicate pred) : m_base(std::move(base)), m_pred(std::move(pred)) {}
+
+template<class Base, class Predicate>
+typename ListFilterView<Base, Predicate>::iterator ListFilterView<Base, Predicate>::begin() const
+{
+	return iterator(m_base.begin(), m_base.end(), &m_pred);
+}
+
+template<class Base, class Predicate>
+typename ListFilterView<Base, Predicate>::iterator ListFilterView<Base, Predicate>::end() const
+{
+	return iterator(m_base.end(), m_base.end(), &m_pred);
+}
+
+// ListTransformView implementation
+
+template<class Base, class Function>
+ListTransformView<Base, Function>::ListTransformView(Base base, Function fn) : m_base(std::move(base)), m_fn(std::move(fn)) {}
+
+template<class Base, class Function>
+typename ListTransformView<Base, Function>::iterator ListTransformView<Base, Function>::begin() const
+{
+	return iterator(m_base.begin(), &m_fn);
+}
+
+template<class Base, class Function>
+typename ListTransformView<Base, Function>::iterator ListTransformView<Base, Function>::end() const
+{
+	return iterator(m_base.end(), &m_fn);
+}
+
+// ListTakeWhileView implementation
+
+template<class Base, class Predicate>
+ListTakeWhileView<Base, Predicate>::ListTakeWhileView(Base base, Predicate pred) : m_base(std::move(base)), m_pred(std::move(pred)) {}
+
+template<class Base, class Predicate>
+typename ListTakeWhileView<Base, Predicate>::iterator ListTakeWhileView<Base, Predicate>::begin() const
+{
+	return iterator(m_base.begin(), m_base.end(), &m_pred);
+}
+
+template<class Base, class Predicate>
+typename ListTakeWhileView<Base, Predicate>::iterator ListTakeWhileView<Base, Predicate>::end() const
+{
+	return iterator(m_base.end(), m_base.end(), &m_pred);
+}
+
+// ListChunkView implementation
+
+template<class Base>
+ListChunkView<Base>::ListChunkView(Base base, size_t count) : m_base(std::move(base)), m_count(count) {}
+
+template<class Base>
+typename ListChunkView<Base>::iterator ListChunkView<Base>::begin() const
+{
+	if (m_count == 0)
+		return end();
+	return iterator(m_base.begin(), m_base.end(), m_count);
+}
+
+template<class Base>
+typename ListChunkView<Base>::iterator ListChunkView<Base>::end() const
+{
+	return iterator(m_base.end(), m_base.end(), m_count);
+}
+
+// ListZipView implementation
+
+template<class Base1, class Base2>
+ListZipView<Base1, Base2>::ListZipView(Base1 first, Base2 second) : m_first(std::move(first)), m_second(std::move(second)) {}
+
+template<class Base1, class Base2>
+typename ListZipView<Base1, Base2>::iterator ListZipView<Base1, Base2>::begin() const
+{
+	return iterator(m_first.begin(), m_first.end(), m_second.begin(), m_second.end());
+}
+
+template<class Base1, class Base2>
+typename ListZipView<Base1, Base2>::iterator ListZipView<Base1, Base2>::end() const
+{
+	return iterator(m_first.end(), m_first.end(), m_second.end(), m_second.end());
+}
+
+// View factories
+
+template<class Range, class Predicate>
+ListFilterView<ListViewStorage<Range>, typename std::decay<Predicate>::type> filter(Range&& range, Predicate&& pred)
+{
+	return ListFilterView<ListViewStorage<Range>, typename std::decay<Predicate>::type>(
+		ListViewStorage<Range>(std::forward<Range>(range)), std::forward<Predicate>(pred));
+}
+
+template<class Range, class Function>
+ListTransformView<ListViewStorage<Range>, typename std::decay<Function>::type> transform(Range&& range, Function&& fn)
+{
+	return ListTransformView<ListViewStorage<Range>, typename std::decay<Function>::type>(
+		ListViewStorage<Range>(std::forward<Range>(range)), std::forward<Function>(fn));
+}
+
+template<class Range, class Predicate>
+ListTakeWhileView<ListViewStorage<Range>, typename std::decay<Predicate>::type> take_while(Range&& range, Predicate&& pred)
+{
+	return ListTakeWhileView<ListViewStorage<Range>, typename std::decay<Predicate>::type>(
+		ListViewStorage<Range>(std::forward<Range>(range)), std::forward<Predicate>(pred));
+}
+
+template<class Range>
+ListChunkView<ListViewStorage<Range>> chunk(Range&& range, size_t count)
+{
+	return ListChunkView<ListViewStorage<Range>>(ListViewStorage<Range>(std::forward<Range>(range)), count);
+}
+
+template<class Range1, class Range2>
+ListZipView<ListViewStorage<Range1>, ListViewStorage<Range2>> zip(Range1&& first, Range2&& second)
+{
+	return ListZipView<ListViewStorage<Range1>, ListViewStorage<Range2>>(
+		ListViewStorage<Range1>(std::forward<Range1>(first)), ListViewStorage<Range2>(std::forward<Range2>(second)));
+}
+
+template<class Range>
+list<ListViewValue<Range>> to_list(const Range& range)
+{
+	return to_list(range, std::allocator<ListViewValue<Range>>());
+}
+
+template<class Range, class Allocator>
+list<typename std::allocator_traits<Allocator>::value_type, Allocator> to_list(const Range& range, const Allocator& alloc)
+{
+	list<typename std::allocator_traits<Allocator>::value_type, Allocator> res(alloc);
+	for (auto it = range.begin(), last = range.end(); it != last; ++it)
+		res.emplace_back(*it);
+	return res;
+}
+
+}
@@ -0,0 +1,250 @@
+#include "../include/lru_cache.h"
+
+namespace blk
+{
+
+// LruCacheEntry implementation
+
+template<class K, class V>
+template<class KeyArg, class... Args>
+LruCacheEntry<K, V>::LruCacheEntry(size_t hash, KeyArg&& key, Args&&... args) :
+	key(std::forward<KeyArg>(key)),
+	value(std::forward<Args>(args)...),
+	bucketNext(nullptr),
+	hash(hash) {}
+
+// lru_cache implementation
+
+template<class K, class V, class Hash, class Allocator>
+lru_cache<K, V, Hash, Allocator>::lru_cache(size_type capacity, const Hash& hash, const Allocator& alloc) :
+	m_list(entry_allocator_type(alloc)),
+	m_buckets(bucket_allocator_type(alloc)),
+	m_capacity(capacity),
+	m_shift(64),
+	m_hash(hash)
+{
+	rehash(8);
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::allocator_type lru_cache<K, V, Hash, Allocator>::get_allocator() const
+{
+	return allocator_type(m_list.get_allocator());
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::hasher lru_cache<K, V, Hash, Allocator>::hash_function() const
+{
+	return m_hash;
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::iterator lru_cache<K, V, Hash, Allocator>::begin() noexcept
+{
+	return m_list.begin();
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::const_iterator lru_cache<K, V, Hash, Allocator>::begin() const noexcept
+{
+	return m_list.begin();
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::iterator lru_cache<K, V, Hash, Allocator>::end() noexcept
+{
+	return m_list.end();
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::const_iterator lru_cache<K, V, Hash, Allocator>::end() const noexcept
+{
+	return m_list.end();
+}
+
+template<class K, class V, class Hash, class Allocator>
+bool lru_cache<K, V, Hash, Allocator>::empty() const noexcept
+{
+	return m_list.empty();
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::size_type lru_cache<K, V, Hash, Allocator>::size() const noexcept
+{
+	return m_list.size();
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::size_type lru_cache<K, V, Hash, Allocator>::capacity() const noexcept
+{
+	return m_capacity;
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::mapped_type* lru_cache<K, V, Hash, Allocator>::get(const key_type& key)
+{
+	entry_node_type *node = findNode(key, m_hash(key));
+	if (!node)
+		return nullptr;
+	touch(const_iterator(node));
+	return &node->val.value;
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::iterator lru_cache<K, V, Hash, Allocator>::find(const key_type& key)
+{
+	entry_node_type *node = findNode(key, m_hash(key));
+	return node ? iterator(node) : end();
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::const_iterator lru_cache<K, V, Hash, Allocator>::find(const key_type& key) const
+{
+	entry_node_type *node = findNode(key, m_hash(key));
+	return node ? const_iterator(node) : end();
+}
+
+template<class K, class V, class Hash, class Allocator>
+bool lru_cache<K, V, Hash, Allocator>::contains(const key_type& key) const
+{
+	return findNode(key, m_hash(key)) != nullptr;
+}
+
+template<class K, class V, class Hash, class Allocator>
+void lru_cache<K, V, Hash, Allocator>::touch(const_iterator pos)
+{
+	m_list.splice(m_list.begin(), m_list, pos);
+}
+
+template<class K, class V, class Hash, class Allocator>
+template<class... Args>
+std::pair<typename lru_cache<K, V, Hash, Allocator>::iterator, bool> lru_cache<K, V, Hash, Allocator>::emplace(const key_type& key, Args&&... args)
+{
+	size_t hash = m_hash(key);
+	entry_node_type *node = findNode(key, hash);
+	if (node)
+	{
+		touch(const_iterator(node));
+		return std::make_pair(iterator(node), false);
+	}
+	if (m_capacity == 0)
+		return std::make_pair(end(), false);
+	if (m_list.size() == m_capacity)
+		evict(1);
+	if (m_list.size() == m_buckets.size())
+		rehash(m_buckets.size() * 2);
+	iterator res = m_list.emplace(m_list.begin(), hash, key, std::forward<Args>(args)...);
+	linkBucket(res.getNode());
+	return std::make_pair(res, true);
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::iterator lru_cache<K, V, Hash, Allocator>::put(const key_type& key, const mapped_type& value)
+{
+	auto res = emplace(key, value);
+	if (!res.second && res.first != end())
+		res.first->value = value;
+	return res.first;
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::iterator lru_cache<K, V, Hash, Allocator>::put(const key_type& key, mapped_type&& value)
+{
+	entry_node_type *node = findNode(key, m_hash(key));
+	if (!node)
+		return emplace(key, std::move(value)).first;
+	node->val.value = std::move(value);
+	touch(const_iterator(node));
+	return iterator(node);
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::iterator lru_cache<K, V, Hash, Allocator>::erase(const_iterator pos)
+{
+	unlinkBucket(pos.getNode());
+	return m_list.erase(pos);
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::size_type lru_cache<K, V, Hash, Allocator>::erase(const key_type& key)
+{
+	entry_node_type *node = findNode(key, m_hash(key));
+	if (!node)
+		return 0;
+	erase(const_iterator(node));
+	return 1;
+}
+
+template<class K, class V, class Hash, class Allocator>
+void lru_cache<K, V, Hash, Allocator>::clear() noexcept
+{
+	m_list.clear();
+	std::fill(m_buckets.begin(), m_buckets.end(), nullptr);
+}
+
+template<class K, class V, class Hash, class Allocator>
+template<class Callback>
+typename lru_cache<K, V, Hash, Allocator>::size_type lru_cache<K, V, Hash, Allocator>::evict(size_type count, Callback callback)
+{
+	count = std::min(count, m_list.size());
+	for (size_type i = 0; i < count; i++)
+	{
+		callback(m_list.back());
+		unlinkBucket(m_list.end().getNode()->prev);
+		m_list.pop_back();
+	}
+	return count;
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::size_type lru_cache<K, V, Hash, Allocator>::evict(size_type count)
+{
+	return evict(count, [](value_type&) {});
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::size_type lru_cache<K, V, Hash, Allocator>::bucketOf(size_t hash) const
+{
+	// Fibonacci hashing spreads identity hashes of small integers over the table
+	return static_cast<size_type>((static_cast<unsigned long long>(hash) * 11400714819323198485ull) >> m_shift);
+}
+
+template<class K, class V, class Hash, class Allocator>
+typename lru_cache<K, V, Hash, Allocator>::entry_node_type* lru_cache<K, V, Hash, Allocator>::findNode(const key_type& key, size_t hash) const
+{
+	for (entry_node_type *node = m_buckets[bucketOf(hash)]; node; node = node->val.bucketNext)
+		if (node->val.hash == hash && node->val.key == key)
+			return node;
+	return nullptr;
+}
+
+template<class K, class V, class Hash, class Allocator>
+void lru_cache<K, V, Hash, Allocator>::linkBucket(entry_node_type* node)
+{
+	entry_node_type *&bucket = m_buckets[bucketOf(node->val.hash)];
+	node->val.bucketNext = bucket;
+	bucket = node;
+}
+
+template<class K, class V, class Hash, class Allocator>
+void lru_cache<K, V, Hash, Allocator>::unlinkBucket(entry_node_type* node)
+{
+	entry_node_type **link = &m_buckets[bucketOf(node->val.hash)];
+	while (*link != node)
+		link = &(*link)->val.bucketNext;
+	*link = node->val.bucketNext;
+}
+
+template<class K, class V, class Hash, class Allocator>
+void lru_cache<K, V, Hash, Allocator>::rehash(size_type bucketCount)
+{
+	unsigned bits = 0;
+	while ((size_type(1) << bits) < bucketCount)
+		bits++;
+	m_buckets.assign(size_type(1) << bits, nullptr);
+	m_shift = 64 - bits;
+	for (auto it = m_list.begin(); it != m_list.end(); ++it)
+		linkBucket(it.getNode());
+}
+
+}
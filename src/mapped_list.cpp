@@ -0,0 +1,415 @@
+#include "../include/mapped_list.h"
+
+namespace blk
+{
+
+// MappedListIterator implementation
+
+template<class T, bool IsConst>
+MappedListIterator<T, IsConst>::MappedListIterator() : m_item(nullptr) {}
+
+template<class T, bool IsConst>
+MappedListIterator<T, IsConst>::MappedListIterator(const MappedListIterator<value_type, false>& it) : m_item(it.getNode()) {}
+
+template<class T, bool IsConst>
+MappedListIterator<T, IsConst>::MappedListIterator(MappedListNode<value_type>* node) : m_item(node) {}
+
+template<class T, bool IsConst>
+template<bool B>
+bool MappedListIterator<T, IsConst>::operator==(const MappedListIterator<value_type, B>& it) const
+{
+	return m_item == it.getNode();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool MappedListIterator<T, IsConst>::operator!=(const MappedListIterator<value_type, B>& it) const
+{
+	return m_item != it.getNode();
+}
+
+template<class T, bool IsConst>
+MappedListIterator<T, IsConst>& MappedListIterator<T, IsConst>::operator++()
+{
+	m_item = reinterpret_cast<MappedListNode<T>*>(reinterpret_cast<char*>(m_item) + m_item->next);
+	return *this;
+}
+
+template<class T, bool IsConst>
+MappedListIterator<T, IsConst>& MappedListIterator<T, IsConst>::operator--()
+{
+	m_item = reinterpret_cast<MappedListNode<T>*>(reinterpret_cast<char*>(m_item) + m_item->prev);
+	return *this;
+}
+
+template<class T, bool IsConst>
+MappedListIterator<T, IsConst> MappedListIterator<T, IsConst>::operator++(int)
+{
+	MappedListIterator res(*this);
+	++*this;
+	return res;
+}
+
+template<class T, bool IsConst>
+MappedListIterator<T, IsConst> MappedListIterator<T, IsConst>::operator--(int)
+{
+	MappedListIterator res(*this);
+	--*this;
+	return res;
+}
+
+template<class T, bool IsConst>
+typename MappedListIterator<T, IsConst>::reference MappedListIterator<T, IsConst>::operator*() const
+{
+	return m_item->val;
+}
+
+template<class T, bool IsConst>
+typename MappedListIterator<T, IsConst>::pointer MappedListIterator<T, IsConst>::operator->() const
+{
+	return &m_item->val;
+}
+
+template<class T, bool IsConst>
+MappedListNode<T>* MappedListIterator<T, IsConst>::getNode() const
+{
+	return m_item;
+}
+
+// mapped_list implementation
+
+template<class T>
+mapped_list<T>::mapped_list(const std::string& path, size_type initialCapacity) :
+	m_fd(-1),
+	m_base(nullptr),
+	m_mapped(0)
+{
+	static const char magic[8] = { 'B', 'L', 'K', 'M', 'L', 'S', 'T', '\0' };
+
+	m_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+	if (m_fd < 0)
+		throw std::system_error(errno, std::system_category(), "mapped_list: open " + path);
+
+	try
+	{
+		struct stat st;
+		if (::fstat(m_fd, &st) != 0)
+			throw std::system_error(errno, std::system_category(), "mapped_list: fstat " + path);
+
+		std::uint64_t minimum = headOffset() + sizeof(node_type);
+		if (st.st_size == 0)
+		{
+			std::uint64_t bytes = minimum + sizeof(node_type) * initialCapacity;
+			if (::ftruncate(m_fd, static_cast<off_t>(bytes)) != 0)
+				throw std::system_error(errno, std::system_category(), "mapped_list: ftruncate " + path);
+			map(bytes);
+
+			MappedListHeader* h = header();
+			std::memcpy(h->magic, magic, sizeof(magic));
+			h->version = formatVersion;
+			h->nodeSize = sizeof(node_type);
+			h->capacity = bytes;
+			h->size = 0;
+			h->freeList = 0;
+			h->bump = minimum;
+			headNode()->next = 0;
+			headNode()->prev = 0;
+		}
+		else
+		{
+			std::uint64_t bytes = static_cast<std::uint64_t>(st.st_size);
+			if (bytes < minimum)
+				throw std::runtime_error("mapped_list: " + path + " is too small to hold a list");
+			map(bytes);
+
+			const MappedListHeader* h = header();
+			if (std::memcmp(h->magic, magic, sizeof(magic)) != 0)
+				throw std::runtime_error("mapped_list: " + path + " is not a mapped_list file");
+			if (h->version != formatVersion)
+				throw std::runtime_error("mapped_list: " + path + " has an unsupported format version");
+			if (h->nodeSize != sizeof(node_type))
+				throw std::runtime_error("mapped_list: " + path + " holds elements of a different size");
+			if (h->capacity > bytes || h->bump > h->capacity)
+				throw std::runtime_error("mapped_list: " + path + " is truncated or corrupt");
+		}
+	}
+	catch (...)
+	{
+		if (m_base)
+			::munmap(m_base, m_mapped);
+		::close(m_fd);
+		throw;
+	}
+}
+
+template<class T>
+mapped_list<T>::mapped_list(mapped_list&& other) noexcept :
+	m_fd(other.m_fd),
+	m_base(other.m_base),
+	m_mapped(other.m_mapped)
+{
+	other.m_fd = -1;
+	other.m_base = nullptr;
+	other.m_mapped = 0;
+}
+
+template<class T>
+mapped_list<T>::~mapped_list()
+{
+	if (m_base)
+		::munmap(m_base, m_mapped);
+	if (m_fd >= 0)
+		::close(m_fd);
+}
+
+template<class T>
+typename mapped_list<T>::reference mapped_list<T>::front()
+{
+	return follow(headNode(), headNode()->next)->val;
+}
+
+template<class T>
+typename mapped_list<T>::const_reference mapped_list<T>::front() const
+{
+	return follow(headNode(), headNode()->next)->val;
+}
+
+template<class T>
+typename mapped_list<T>::reference mapped_list<T>::back()
+{
+	return follow(headNode(), headNode()->prev)->val;
+}
+
+template<class T>
+typename mapped_list<T>::const_reference mapped_list<T>::back() const
+{
+	return follow(headNode(), headNode()->prev)->val;
+}
+
+template<class T>
+typename mapped_list<T>::iterator mapped_list<T>::begin() noexcept
+{
+	return iterator(follow(headNode(), headNode()->next));
+}
+
+template<class T>
+typename mapped_list<T>::const_iterator mapped_list<T>::begin() const noexcept
+{
+	return const_iterator(follow(headNode(), headNode()->next));
+}
+
+template<class T>
+typename mapped_list<T>::const_iterator mapped_list<T>::cbegin() const noexcept
+{
+	return begin();
+}
+
+template<class T>
+typename mapped_list<T>::iterator mapped_list<T>::end() noexcept
+{
+	return iterator(headNode());
+}
+
+template<class T>
+typename mapped_list<T>::const_iterator mapped_list<T>::end() const noexcept
+{
+	return const_iterator(headNode());
+}
+
+template<class T>
+typename mapped_list<T>::const_iterator mapped_list<T>::cend() const noexcept
+{
+	return end();
+}
+
+template<class T>
+bool mapped_list<T>::empty() const noexcept
+{
+	return header()->size == 0;
+}
+
+template<class T>
+typename mapped_list<T>::size_type mapped_list<T>::size() const noexcept
+{
+	return static_cast<size_type>(header()->size);
+}
+
+template<class T>
+typename mapped_list<T>::size_type mapped_list<T>::capacity() const noexcept
+{
+	return static_cast<size_type>((header()->capacity - headOffset()) / sizeof(node_type) - 1);
+}
+
+template<class T>
+void mapped_list<T>::clear() noexcept
+{
+	// Every node past the sentinel is either linked or free, so the whole
+	// node area is handed back to the bump allocator at once
+	MappedListHeader* h = header();
+	h->size = 0;
+	h->freeList = 0;
+	h->bump = headOffset() + sizeof(node_type);
+	headNode()->next = 0;
+	headNode()->prev = 0;
+}
+
+template<class T>
+typename mapped_list<T>::iterator mapped_list<T>::insert(const_iterator pos, const value_type& value)
+{
+	// Growing remaps the file, so keep the position as an offset and the
+	// value as a copy in case it lives inside the mapping
+	value_type copy = value;
+	std::uint64_t posOffset = static_cast<std::uint64_t>(reinterpret_cast<char*>(pos.getNode()) - m_base);
+	node_type* node = allocateNode();
+	std::memcpy(&node->val, &copy, sizeof(value_type));
+	link(node, nodeAt(posOffset));
+	++header()->size;
+	return iterator(node);
+}
+
+template<class T>
+typename mapped_list<T>::iterator mapped_list<T>::erase(const_iterator pos)
+{
+	node_type* node = pos.getNode();
+	node_type* next = follow(node, node->next);
+	node_type* prev = follow(node, node->prev);
+	prev->next = offsetTo(prev, next);
+	next->prev = offsetTo(next, prev);
+	freeNode(node);
+	--header()->size;
+	return iterator(next);
+}
+
+template<class T>
+void mapped_list<T>::push_front(const value_type& value)
+{
+	insert(begin(), value);
+}
+
+template<class T>
+void mapped_list<T>::push_back(const value_type& value)
+{
+	insert(end(), value);
+}
+
+template<class T>
+void mapped_list<T>::pop_front()
+{
+	erase(begin());
+}
+
+template<class T>
+void mapped_list<T>::pop_back()
+{
+	erase(const_iterator(follow(headNode(), headNode()->prev)));
+}
+
+template<class T>
+void mapped_list<T>::checkpoint(bool async)
+{
+	if (::msync(m_base, m_mapped, async ? MS_ASYNC : MS_SYNC) != 0)
+		throw std::system_error(errno, std::system_category(), "mapped_list: msync");
+}
+
+template<class T>
+typename mapped_list<T>::node_type* mapped_list<T>::follow(node_type* node, std::int64_t offset)
+{
+	return reinterpret_cast<node_type*>(reinterpret_cast<char*>(node) + offset);
+}
+
+template<class T>
+std::int64_t mapped_list<T>::offsetTo(const node_type* from, const node_type* to)
+{
+	return reinterpret_cast<const char*>(to) - reinterpret_cast<const char*>(from);
+}
+
+template<class T>
+std::uint64_t mapped_list<T>::headOffset()
+{
+	const std::uint64_t align = alignof(node_type) > alignof(MappedListHeader) ? alignof(node_type) : alignof(MappedListHeader);
+	return (sizeof(MappedListHeader) + align - 1) / align * align;
+}
+
+template<class T>
+MappedListHeader* mapped_list<T>::header() const
+{
+	return reinterpret_cast<MappedListHeader*>(m_base);
+}
+
+template<class T>
+typename mapped_list<T>::node_type* mapped_list<T>::headNode() const
+{
+	return nodeAt(headOffset());
+}
+
+template<class T>
+typename mapped_list<T>::node_type* mapped_list<T>::nodeAt(std::uint64_t offset) const
+{
+	return reinterpret_cast<node_type*>(m_base + offset);
+}
+
+template<class T>
+void mapped_list<T>::link(node_type* node, node_type* pos)
+{
+	node_type* prev = follow(pos, pos->prev);
+	node->next = offsetTo(node, pos);
+	node->prev = offsetTo(node, prev);
+	prev->next = offsetTo(prev, node);
+	pos->prev = offsetTo(pos, node);
+}
+
+template<class T>
+typename mapped_list<T>::node_type* mapped_list<T>::allocateNode()
+{
+	MappedListHeader* h = header();
+	if (h->freeList)
+	{
+		// Free nodes keep the file offset of the next free node in `next`
+		node_type* node = nodeAt(h->freeList);
+		h->freeList = static_cast<std::uint64_t>(node->next);
+		return node;
+	}
+	if (h->bump + sizeof(node_type) > h->capacity)
+	{
+		grow();
+		h = header();
+	}
+	node_type* node = nodeAt(h->bump);
+	h->bump += sizeof(node_type);
+	return node;
+}
+
+template<class T>
+void mapped_list<T>::freeNode(node_type* node)
+{
+	MappedListHeader* h = header();
+	node->next = static_cast<std::int64_t>(h->freeList);
+	h->freeList = static_cast<std::uint64_t>(reinterpret_cast<char*>(node) - m_base);
+}
+
+template<class T>
+void mapped_list<T>::map(std::uint64_t bytes)
+{
+	void* base = ::mmap(nullptr, static_cast<size_t>(bytes), PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+	if (base == MAP_FAILED)
+		throw std::system_error(errno, std::system_category(), "mapped_list: mmap");
+	m_base = static_cast<char*>(base);
+	m_mapped = bytes;
+}
+
+template<class T>
+void mapped_list<T>::grow()
+{
+	std::uint64_t bytes = header()->capacity * 2;
+	if (::ftruncate(m_fd, static_cast<off_t>(bytes)) != 0)
+		throw std::system_error(errno, std::system_category(), "mapped_list: ftruncate");
+	// Map the larger file before dropping the old mapping, so a failure
+	// leaves the list usable
+	char* old = m_base;
+	std::uint64_t oldBytes = m_mapped;
+	map(bytes);
+	::munmap(old, oldBytes);
+	header()->capacity = bytes;
+}
+
+}
@@ -0,0 +1,437 @@
+#include "../include/pairing_heap.h"
+
+namespace blk
+{
+
+// PairingHeapHandle implementation
+
+template<class T>
+PairingHeapHandle<T>::PairingHeapHandle() :
+	m_node(nullptr) {}
+
+template<class T>
+PairingHeapHandle<T>::PairingHeapHandle(PairingHeapNode<value_type>* node) :
+	m_node(node) {}
+
+template<class T>
+bool PairingHeapHandle<T>::operator==(const PairingHeapHandle& handle) const
+{
+	return m_node == handle.m_node;
+}
+
+template<class T>
+bool PairingHeapHandle<T>::operator!=(const PairingHeapHandle& handle) const
+{
+	return m_node != handle.m_node;
+}
+
+template<class T>
+const typename PairingHeapHandle<T>::value_type& PairingHeapHandle<T>::operator*() const
+{
+	return m_node->val;
+}
+
+template<class T>
+const typename PairingHeapHandle<T>::value_type* PairingHeapHandle<T>::operator->() const
+{
+	return &m_node->val;
+}
+
+template<class T>
+PairingHeapNode<typename PairingHeapHandle<T>::value_type>* PairingHeapHandle<T>::getNode() const
+{
+	return m_node;
+}
+
+// pairing_heap implementation
+
+template<class T, class Compare, class Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap() :
+	pairing_heap(Compare()) {}
+
+template<class T, class Compare, class Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(const Compare& comp, const Allocator& alloc) :
+	m_alloc(alloc),
+	m_comp(comp),
+	m_root(nullptr),
+	m_size(0) {}
+
+template<class T, class Compare, class Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(const Allocator& alloc) :
+	pairing_heap(Compare(), alloc) {}
+
+template<class T, class Compare, class Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(const pairing_heap& other) :
+	pairing_heap(other.m_comp, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.m_alloc))
+{
+	m_root = cloneTree<const T&>(other.m_root);
+	m_size = other.m_size;
+}
+
+template<class T, class Compare, class Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(pairing_heap&& other) noexcept :
+	m_alloc(std::move(other.m_alloc)),
+	m_comp(std::move(other.m_comp)),
+	m_root(other.m_root),
+	m_size(other.m_size)
+{
+	other.m_root = nullptr;
+	other.m_size = 0;
+}
+
+template<class T, class Compare, class Allocator>
+pairing_heap<T, Compare, Allocator>::~pairing_heap()
+{
+	destroyTree(m_root);
+}
+
+template<class T, class Compare, class Allocator>
+pairing_heap<T, Compare, Allocator>& pairing_heap<T, Compare, Allocator>::operator=(const pairing_heap& other)
+{
+	if (this == &other)
+		return *this;
+	clear();
+	if (std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value)
+		m_alloc = other.m_alloc;
+	m_comp = other.m_comp;
+	m_root = cloneTree<const T&>(other.m_root);
+	m_size = other.m_size;
+	return *this;
+}
+
+template<class T, class Compare, class Allocator>
+pairing_heap<T, Compare, Allocator>& pairing_heap<T, Compare, Allocator>::operator=(pairing_heap&& other)
+{
+	if (this == &other)
+		return *this;
+	clear();
+	m_comp = std::move(other.m_comp);
+	if (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value || m_alloc == other.m_alloc)
+	{
+		m_alloc = std::move(other.m_alloc);
+		m_root = other.m_root;
+		m_size = other.m_size;
+		other.m_root = nullptr;
+		other.m_size = 0;
+	}
+	else
+	{
+		m_root = cloneTree<T&&>(other.m_root);
+		m_size = other.m_size;
+		other.clear();
+	}
+	return *this;
+}
+
+template<class T, class Compare, class Allocator>
+typename pairing_heap<T, Compare, Allocator>::allocator_type pairing_heap<T, Compare, Allocator>::get_allocator() const
+{
+	return m_alloc;
+}
+
+template<class T, class Compare, class Allocator>
+typename pairing_heap<T, Compare, Allocator>::value_compare pairing_heap<T, Compare, Allocator>::value_comp() const
+{
+	return m_comp;
+}
+
+template<class T, class Compare, class Allocator>
+typename pairing_heap<T, Compare, Allocator>::const_reference pairing_heap<T, Compare, Allocator>::top() const
+{
+	return m_root->val;
+}
+
+template<class T, class Compare, class Allocator>
+bool pairing_heap<T, Compare, Allocator>::empty() const noexcept
+{
+	return m_size == 0;
+}
+
+template<class T, class Compare, class Allocator>
+typename pairing_heap<T, Compare, Allocator>::size_type pairing_heap<T, Compare, Allocator>::size() const noexcept
+{
+	return m_size;
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::clear() noexcept
+{
+	destroyTree(m_root);
+	m_root = nullptr;
+	m_size = 0;
+}
+
+template<class T, class Compare, class Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle_type pairing_heap<T, Compare, Allocator>::push(const value_type& value)
+{
+	return emplace(value);
+}
+
+template<class T, class Compare, class Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle_type pairing_heap<T, Compare, Allocator>::push(value_type&& value)
+{
+	return emplace(std::move(value));
+}
+
+template<class T, class Compare, class Allocator>
+template<class... Args>
+typename pairing_heap<T, Compare, Allocator>::handle_type pairing_heap<T, Compare, Allocator>::emplace(Args&&... args)
+{
+	node_type *node = createNode(std::forward<Args>(args)...);
+	insertRoot(node);
+	m_size++;
+	return handle_type(node);
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::pop()
+{
+	node_type *root = m_root;
+	m_root = mergePairs(root->child);
+	destroyNode(root);
+	m_size--;
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::erase(handle_type handle)
+{
+	node_type *node = handle.getNode();
+	if (node == m_root)
+	{
+		pop();
+		return;
+	}
+	detach(node);
+	node_type *children = mergePairs(node->child);
+	destroyNode(node);
+	m_size--;
+	if (children)
+		m_root = link(m_root, children);
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::decrease_key(handle_type handle, const value_type& value)
+{
+	raise(handle.getNode(), value);
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::decrease_key(handle_type handle, value_type&& value)
+{
+	raise(handle.getNode(), std::move(value));
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::meld(pairing_heap& other)
+{
+	if (this == &other || other.empty())
+		return;
+	node_type *root;
+	size_type count = other.m_size;
+	if (ListNodeTransfer<Allocator>::canRelinkAll(m_alloc, other.m_alloc))
+	{
+		root = other.m_root;
+		other.m_root = nullptr;
+		other.m_size = 0;
+	}
+	else
+	{
+		root = cloneTree<T&&>(other.m_root);
+		other.clear();
+	}
+	insertRoot(root);
+	m_size += count;
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::meld(pairing_heap&& other)
+{
+	meld(other);
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::swap(pairing_heap& other)
+{
+	if (std::allocator_traits<Allocator>::propagate_on_container_swap::value)
+		std::swap(m_alloc, other.m_alloc);
+	std::swap(m_comp, other.m_comp);
+	std::swap(m_root, other.m_root);
+	std::swap(m_size, other.m_size);
+}
+
+template<class T, class Compare, class Allocator>
+template<class... Args>
+typename pairing_heap<T, Compare, Allocator>::node_type* pairing_heap<T, Compare, Allocator>::createNode(Args&&... args)
+{
+	node_allocator_type nodeAlloc(m_alloc);
+	node_type *node = std::allocator_traits<node_allocator_type>::allocate(nodeAlloc, 1);
+	try
+	{
+		std::allocator_traits<Allocator>::construct(m_alloc, &node->val, std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
+		throw;
+	}
+	node->next = node->prev = node->child = nullptr;
+	return node;
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::destroyNode(node_type* node) noexcept
+{
+	node_allocator_type nodeAlloc(m_alloc);
+	std::allocator_traits<Allocator>::destroy(m_alloc, &node->val);
+	std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::destroyTree(node_type* root) noexcept
+{
+	// Children are spliced into the sibling chain ahead of the rest, so every
+	// chain is walked once and the whole tree is freed in O(n)
+	while (root)
+	{
+		if (root->child)
+		{
+			node_type *last = root->child;
+			while (last->next)
+				last = last->next;
+			last->next = root->next;
+			root->next = root->child;
+		}
+		node_type *next = root->next;
+		destroyNode(root);
+		root = next;
+	}
+}
+
+template<class T, class Compare, class Allocator>
+template<class Value>
+typename pairing_heap<T, Compare, Allocator>::node_type* pairing_heap<T, Compare, Allocator>::cloneTree(node_type* root)
+{
+	if (!root)
+		return nullptr;
+	node_type *res = createNode(static_cast<Value>(root->val));
+	std::vector<std::pair<node_type*, node_type*>> pending { { root, res } };
+	try
+	{
+		while (!pending.empty())
+		{
+			node_type *from = pending.back().first;
+			node_type *to = pending.back().second;
+			pending.pop_back();
+			node_type *last = nullptr;
+			for (node_type *child = from->child; child; child = child->next)
+			{
+				node_type *node = createNode(static_cast<Value>(child->val));
+				node->prev = last ? last : to;
+				if (last)
+					last->next = node;
+				else
+					to->child = node;
+				last = node;
+				pending.emplace_back(child, node);
+			}
+		}
+	}
+	catch (...)
+	{
+		destroyTree(res);
+		throw;
+	}
+	return res;
+}
+
+template<class T, class Compare, class Allocator>
+typename pairing_heap<T, Compare, Allocator>::node_type* pairing_heap<T, Compare, Allocator>::link(node_type* left, node_type* right)
+{
+	// Both are detached roots; the loser becomes the first child
+	if (m_comp(left->val, right->val))
+		std::swap(left, right);
+	right->next = left->child;
+	if (left->child)
+		left->child->prev = right;
+	right->prev = left;
+	left->child = right;
+	return left;
+}
+
+template<class T, class Compare, class Allocator>
+typename pairing_heap<T, Compare, Allocator>::node_type* pairing_heap<T, Compare, Allocator>::mergePairs(node_type* first)
+{
+	if (!first)
+		return nullptr;
+	// Left to right, link siblings in pairs and stack the winners
+	node_type *pairs = nullptr;
+	while (first)
+	{
+		node_type *left = first;
+		node_type *right = left->next;
+		first = right ? right->next : nullptr;
+		left->next = left->prev = nullptr;
+		if (right)
+		{
+			right->next = right->prev = nullptr;
+			left = link(left, right);
+		}
+		left->next = pairs;
+		pairs = left;
+	}
+	// Right to left, fold the winners into one tree
+	node_type *res = pairs;
+	pairs = pairs->next;
+	res->next = nullptr;
+	while (pairs)
+	{
+		node_type *node = pairs;
+		pairs = pairs->next;
+		node->next = nullptr;
+		res = link(res, node);
+	}
+	return res;
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::detach(node_type* node) noexcept
+{
+	if (node->prev->child == node)
+		node->prev->child = node->next;
+	else
+		node->prev->next = node->next;
+	if (node->next)
+		node->next->prev = node->prev;
+	node->next = node->prev = nullptr;
+}
+
+template<class T, class Compare, class Allocator>
+void pairing_heap<T, Compare, Allocator>::insertRoot(node_type* node)
+{
+	m_root = m_root ? link(m_root, node) : node;
+}
+
+template<class T, class Compare, class Allocator>
+template<class Value>
+void pairing_heap<T, Compare, Allocator>::raise(node_type* node, Value&& value)
+{
+	if (m_comp(value, node->val))
+		throw std::invalid_argument("decrease_key value ranks below the current one");
+	node->val = std::forward<Value>(value);
+	if (node == m_root)
+		return;
+	// The subtree stays heap ordered, so it is cut and linked to the root
+	detach(node);
+	m_root = link(m_root, node);
+}
+
+}
+
+namespace std
+{
+	template<class T, class Compare, class Alloc>
+	void swap(blk::pairing_heap<T, Compare, Alloc>& left, blk::pairing_heap<T, Compare, Alloc>& right)
+	{
+		left.swap(right);
+	}
+}
@@ -0,0 +1,536 @@
+#include "../include/persistent_list.h"
+
+namespace blk
+{
+
+// PersistentListIterator implementation
+
+template<class T>
+PersistentListIterator<T>::PersistentListIterator() : m_item(nullptr) {}
+
+template<class T>
+PersistentListIterator<T>::PersistentListIterator(PersistentListNode<value_type>* node) : m_item(node) {}
+
+template<class T>
+bool PersistentListIterator<T>::operator==(const PersistentListIterator& it) const
+{
+	return m_item == it.m_item;
+}
+
+template<class T>
+bool PersistentListIterator<T>::operator!=(const PersistentListIterator& it) const
+{
+	return m_item != it.m_item;
+}
+
+template<class T>
+PersistentListIterator<T>& PersistentListIterator<T>::operator++()
+{
+	m_item = m_item->next;
+	return *this;
+}
+
+template<class T>
+PersistentListIterator<T> PersistentListIterator<T>::operator++(int)
+{
+	PersistentListIterator res(*this);
+	m_item = m_item->next;
+	return res;
+}
+
+template<class T>
+typename PersistentListIterator<T>::reference PersistentListIterator<T>::operator*() const
+{
+	return m_item->val;
+}
+
+template<class T>
+typename PersistentListIterator<T>::pointer PersistentListIterator<T>::operator->() const
+{
+	return &m_item->val;
+}
+
+template<class T>
+PersistentListNode<T>* PersistentListIterator<T>::getNode() const
+{
+	return m_item;
+}
+
+// persistent_list implementation
+
+template<class T, class Allocator>
+persistent_list<T, Allocator>::persistent_list() :
+	persistent_list(Allocator()) {}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator>::persistent_list(const Allocator& alloc) :
+	m_alloc(alloc),
+	m_head(nullptr),
+	m_size(0) {}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+persistent_list<T, Allocator>::persistent_list(InputIt first, InputIt last, const Allocator& alloc) :
+	persistent_list(alloc)
+{
+	transient_type builder(alloc);
+	for (; first != last; ++first)
+		builder.push_back(*first);
+	*this = builder.persistent();
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator>::persistent_list(std::initializer_list<T> init, const Allocator& alloc) :
+	persistent_list(init.begin(), init.end(), alloc) {}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator>::persistent_list(const persistent_list& other) noexcept :
+	m_alloc(other.m_alloc),
+	m_head(other.m_head),
+	m_size(other.m_size)
+{
+	retain(m_head);
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator>::persistent_list(persistent_list&& other) noexcept :
+	m_alloc(other.m_alloc),
+	m_head(other.m_head),
+	m_size(other.m_size)
+{
+	other.m_head = nullptr;
+	other.m_size = 0;
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator>::persistent_list(node_type* head, size_type size, const Allocator& alloc) noexcept :
+	m_alloc(alloc),
+	m_head(head),
+	m_size(size) {}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator>::~persistent_list()
+{
+	release(m_head);
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator>& persistent_list<T, Allocator>::operator=(const persistent_list& other) noexcept
+{
+	retain(other.m_head);
+	release(m_head);
+	m_alloc = other.m_alloc;
+	m_head = other.m_head;
+	m_size = other.m_size;
+	return *this;
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator>& persistent_list<T, Allocator>::operator=(persistent_list&& other) noexcept
+{
+	if (this != &other)
+	{
+		release(m_head);
+		m_alloc = other.m_alloc;
+		m_head = other.m_head;
+		m_size = other.m_size;
+		other.m_head = nullptr;
+		other.m_size = 0;
+	}
+	return *this;
+}
+
+template<class T, class Allocator>
+typename persistent_list<T, Allocator>::allocator_type persistent_list<T, Allocator>::get_allocator() const
+{
+	return m_alloc;
+}
+
+template<class T, class Allocator>
+typename persistent_list<T, Allocator>::const_reference persistent_list<T, Allocator>::front() const
+{
+	return m_head->val;
+}
+
+template<class T, class Allocator>
+typename persistent_list<T, Allocator>::const_iterator persistent_list<T, Allocator>::begin() const noexcept
+{
+	return const_iterator(m_head);
+}
+
+template<class T, class Allocator>
+typename persistent_list<T, Allocator>::const_iterator persistent_list<T, Allocator>::cbegin() const noexcept
+{
+	return const_iterator(m_head);
+}
+
+template<class T, class Allocator>
+typename persistent_list<T, Allocator>::const_iterator persistent_list<T, Allocator>::end() const noexcept
+{
+	return const_iterator();
+}
+
+template<class T, class Allocator>
+typename persistent_list<T, Allocator>::const_iterator persistent_list<T, Allocator>::cend() const noexcept
+{
+	return const_iterator();
+}
+
+template<class T, class Allocator>
+bool persistent_list<T, Allocator>::empty() const noexcept
+{
+	return m_head == nullptr;
+}
+
+template<class T, class Allocator>
+typename persistent_list<T, Allocator>::size_type persistent_list<T, Allocator>::size() const noexcept
+{
+	return m_size;
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator> persistent_list<T, Allocator>::push_front(const value_type& value) const
+{
+	return emplace_front(value);
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator> persistent_list<T, Allocator>::push_front(value_type&& value) const
+{
+	return emplace_front(std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+persistent_list<T, Allocator> persistent_list<T, Allocator>::emplace_front(Args&&... args) const
+{
+	node_type *node = allocateNode(m_head, std::forward<Args>(args)...);
+	retain(m_head);
+	return persistent_list(node, m_size + 1, m_alloc);
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator> persistent_list<T, Allocator>::pop_front() const
+{
+	retain(m_head->next);
+	return persistent_list(m_head->next, m_size - 1, m_alloc);
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator> persistent_list<T, Allocator>::push_back(const value_type& value) const
+{
+	node_type *node = allocateNode(nullptr, value);
+	return persistent_list(copyRange(m_head, nullptr, node), m_size + 1, m_alloc);
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator> persistent_list<T, Allocator>::insert(const_iterator pos, const value_type& value) const
+{
+	node_type *node = allocateNode(pos.getNode(), value);
+	retain(pos.getNode());
+	return persistent_list(copyRange(m_head, pos.getNode(), node), m_size + 1, m_alloc);
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator> persistent_list<T, Allocator>::erase(const_iterator pos) const
+{
+	node_type *suffix = pos.getNode()->next;
+	retain(suffix);
+	return persistent_list(copyRange(m_head, pos.getNode(), suffix), m_size - 1, m_alloc);
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator> persistent_list<T, Allocator>::set(const_iterator pos, const value_type& value) const
+{
+	node_type *suffix = pos.getNode()->next;
+	node_type *node = allocateNode(suffix, value);
+	retain(suffix);
+	return persistent_list(copyRange(m_head, pos.getNode(), node), m_size, m_alloc);
+}
+
+template<class T, class Allocator>
+persistent_list<T, Allocator> persistent_list<T, Allocator>::splice(const_iterator pos, const persistent_list& other) const
+{
+	if (other.empty())
+		return *this;
+	node_type *suffix = pos.getNode();
+	retain(suffix);
+	node_type *middle;
+	if (suffix == nullptr)
+	{
+		// Nothing follows other, so it can be shared as it is
+		middle = other.m_head;
+		retain(middle);
+	}
+	else
+		middle = copyRange(other.m_head, nullptr, suffix);
+	return persistent_list(copyRange(m_head, suffix, middle), m_size + other.m_size, m_alloc);
+}
+
+template<class T, class Allocator>
+typename persistent_list<T, Allocator>::transient_type persistent_list<T, Allocator>::transient() const
+{
+	return transient_type(*this);
+}
+
+template<class T, class Allocator>
+template<class... Args>
+PersistentListNode<T>* persistent_list<T, Allocator>::allocateNode(node_type* next, Args&&... args) const
+{
+	node_allocator_type nodeAlloc(m_alloc);
+	node_type *node = std::allocator_traits<node_allocator_type>::allocate(nodeAlloc, 1);
+	try
+	{
+		Allocator alloc(m_alloc);
+		std::allocator_traits<Allocator>::construct(alloc, &node->val, std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
+		throw;
+	}
+	new (&node->refs) std::atomic<size_t>(1);
+	node->next = next;
+	return node;
+}
+
+template<class T, class Allocator>
+void persistent_list<T, Allocator>::retain(node_type* node) noexcept
+{
+	if (node != nullptr)
+		node->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<class T, class Allocator>
+void persistent_list<T, Allocator>::release(node_type* node) const noexcept
+{
+	// Iterative, so that dropping a long chain does not recurse
+	node_allocator_type nodeAlloc(m_alloc);
+	Allocator alloc(m_alloc);
+	while (node != nullptr && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		node_type *next = node->next;
+		std::allocator_traits<Allocator>::destroy(alloc, &node->val);
+		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
+		node = next;
+	}
+}
+
+template<class T, class Allocator>
+PersistentListNode<T>* persistent_list<T, Allocator>::copyRange(node_type* first, node_type* last, node_type* suffix) const
+{
+	// Takes over the reference to suffix, also when a copy throws
+	node_type *head = nullptr;
+	node_type **link = &head;
+	try
+	{
+		for (; first != last; first = first->next)
+		{
+			*link = allocateNode(nullptr, first->val);
+			link = &(*link)->next;
+		}
+	}
+	catch (...)
+	{
+		release(head);
+		release(suffix);
+		throw;
+	}
+	*link = suffix;
+	return head;
+}
+
+// PersistentListTransient implementation
+
+template<class T, class Allocator>
+PersistentListTransient<T, Allocator>::PersistentListTransient(const Allocator& alloc) :
+	m_list(alloc),
+	m_tail(nullptr),
+	m_unique(true) {}
+
+template<class T, class Allocator>
+PersistentListTransient<T, Allocator>::PersistentListTransient(const list_type& from) :
+	m_list(from),
+	m_tail(nullptr),
+	m_unique(from.empty()) {}
+
+template<class T, class Allocator>
+PersistentListTransient<T, Allocator>::PersistentListTransient(PersistentListTransient&& other) noexcept :
+	m_list(std::move(other.m_list)),
+	m_tail(other.m_tail),
+	m_unique(other.m_unique)
+{
+	other.m_tail = nullptr;
+	other.m_unique = true;
+}
+
+template<class T, class Allocator>
+PersistentListTransient<T, Allocator>::~PersistentListTransient() {}
+
+template<class T, class Allocator>
+typename PersistentListTransient<T, Allocator>::const_iterator PersistentListTransient<T, Allocator>::begin() const noexcept
+{
+	return m_list.begin();
+}
+
+template<class T, class Allocator>
+typename PersistentListTransient<T, Allocator>::const_iterator PersistentListTransient<T, Allocator>::end() const noexcept
+{
+	return m_list.end();
+}
+
+template<class T, class Allocator>
+bool PersistentListTransient<T, Allocator>::empty() const noexcept
+{
+	return m_list.empty();
+}
+
+template<class T, class Allocator>
+typename PersistentListTransient<T, Allocator>::size_type PersistentListTransient<T, Allocator>::size() const noexcept
+{
+	return m_list.size();
+}
+
+template<class T, class Allocator>
+T& PersistentListTransient<T, Allocator>::front()
+{
+	node_type *head = m_list.m_head;
+	if (head->refs.load(std::memory_order_acquire) != 1)
+	{
+		// Only the first node is copied; the rest stays shared
+		node_type *copy = m_list.allocateNode(head->next, head->val);
+		list_type::retain(head->next);
+		m_list.release(head);
+		m_list.m_head = copy;
+		if (m_list.m_size == 1)
+		{
+			m_tail = copy;
+			m_unique = true;
+		}
+	}
+	return m_list.m_head->val;
+}
+
+template<class T, class Allocator>
+T& PersistentListTransient<T, Allocator>::back()
+{
+	makeUnique();
+	return m_tail->val;
+}
+
+template<class T, class Allocator>
+void PersistentListTransient<T, Allocator>::push_front(const value_type& value)
+{
+	emplace_front(value);
+}
+
+template<class T, class Allocator>
+void PersistentListTransient<T, Allocator>::push_front(value_type&& value)
+{
+	emplace_front(std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+T& PersistentListTransient<T, Allocator>::emplace_front(Args&&... args)
+{
+	// The new node takes over the reference the builder held on the old head
+	node_type *node = m_list.allocateNode(m_list.m_head, std::forward<Args>(args)...);
+	if (m_list.m_head == nullptr)
+		m_tail = node;
+	m_list.m_head = node;
+	m_list.m_size++;
+	return node->val;
+}
+
+template<class T, class Allocator>
+void PersistentListTransient<T, Allocator>::push_back(const value_type& value)
+{
+	emplace_back(value);
+}
+
+template<class T, class Allocator>
+void PersistentListTransient<T, Allocator>::push_back(value_type&& value)
+{
+	emplace_back(std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+T& PersistentListTransient<T, Allocator>::emplace_back(Args&&... args)
+{
+	makeUnique();
+	node_type *node = m_list.allocateNode(nullptr, std::forward<Args>(args)...);
+	if (m_tail == nullptr)
+		m_list.m_head = node;
+	else
+		m_tail->next = node;
+	m_tail = node;
+	m_list.m_size++;
+	return node->val;
+}
+
+template<class T, class Allocator>
+void PersistentListTransient<T, Allocator>::pop_front()
+{
+	node_type *head = m_list.m_head;
+	list_type::retain(head->next);
+	m_list.m_head = head->next;
+	m_list.m_size--;
+	m_list.release(head);
+	if (m_list.m_head == nullptr)
+	{
+		m_tail = nullptr;
+		m_unique = true;
+	}
+}
+
+template<class T, class Allocator>
+typename PersistentListTransient<T, Allocator>::list_type PersistentListTransient<T, Allocator>::persistent()
+{
+	list_type res(std::move(m_list));
+	m_list = list_type(res.get_allocator());
+	m_tail = nullptr;
+	m_unique = true;
+	return res;
+}
+
+template<class T, class Allocator>
+void PersistentListTransient<T, Allocator>::makeUnique()
+{
+	if (m_unique)
+		return;
+	// Every node behind a shared one is shared as well, so the exclusively
+	// owned part is a prefix; copy the rest once
+	node_type **link = &m_list.m_head;
+	node_type *tail = nullptr;
+	while (*link != nullptr && (*link)->refs.load(std::memory_order_acquire) == 1)
+	{
+		tail = *link;
+		link = &tail->next;
+	}
+	node_type *shared = *link;
+	if (shared != nullptr)
+	{
+		node_type *copy = m_list.copyRange(shared, nullptr, nullptr);
+		*link = copy;
+		m_list.release(shared);
+		for (tail = copy; tail->next != nullptr; tail = tail->next);
+	}
+	m_tail = tail;
+	m_unique = true;
+}
+
+template<class T, class Alloc>
+bool operator==(const persistent_list<T, Alloc>& left, const persistent_list<T, Alloc>& right)
+{
+	return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin());
+}
+
+template<class T, class Alloc>
+bool operator!=(const persistent_list<T, Alloc>& left, const persistent_list<T, Alloc>& right)
+{
+	return !(left == right);
+}
+
+}
@@ -0,0 +1,434 @@
+#include "../include/reversible_list.h"
+
+namespace blk
+{
+
+// ReversibleListIterator implementation
+
+template<class T, bool IsConst>
+ReversibleListIterator<T, IsConst>::ReversibleListIterator() :
+	m_item(nullptr),
+	m_reversed(false) {}
+
+template<class T, bool IsConst>
+ReversibleListIterator<T, IsConst>::ReversibleListIterator(const ReversibleListIterator<value_type, false>& it) :
+	m_item(it.getNode()),
+	m_reversed(it.isReversed()) {}
+
+template<class T, bool IsConst>
+ReversibleListIterator<T, IsConst>::ReversibleListIterator(ListNode<value_type>* node, bool reversed) :
+	m_item(node),
+	m_reversed(reversed) {}
+
+template<class T, bool IsConst>
+template<bool B>
+bool ReversibleListIterator<T, IsConst>::operator==(const ReversibleListIterator<value_type, B>& it) const
+{
+	return m_item == it.getNode();
+}
+
+template<class T, bool IsConst>
+template<bool B>
+bool ReversibleListIterator<T, IsConst>::operator!=(const ReversibleListIterator<value_type, B>& it) const
+{
+	return !(*this == it);
+}
+
+template<class T, bool IsConst>
+ReversibleListIterator<T, IsConst>& ReversibleListIterator<T, IsConst>::operator++()
+{
+	m_item = m_reversed ? m_item->prev : m_item->next;
+	return *this;
+}
+
+template<class T, bool IsConst>
+ReversibleListIterator<T, IsConst>& ReversibleListIterator<T, IsConst>::operator--()
+{
+	m_item = m_reversed ? m_item->next : m_item->prev;
+	return *this;
+}
+
+template<class T, bool IsConst>
+ReversibleListIterator<T, IsConst> ReversibleListIterator<T, IsConst>::operator++(int)
+{
+	ReversibleListIterator res(*this);
+	++*this;
+	return res;
+}
+
+template<class T, bool IsConst>
+ReversibleListIterator<T, IsConst> ReversibleListIterator<T, IsConst>::operator--(int)
+{
+	ReversibleListIterator res(*this);
+	--*this;
+	return res;
+}
+
+template<class T, bool IsConst>
+typename ReversibleListIterator<T, IsConst>::reference ReversibleListIterator<T, IsConst>::operator*() const
+{
+	return m_item->val;
+}
+
+template<class T, bool IsConst>
+typename ReversibleListIterator<T, IsConst>::pointer ReversibleListIterator<T, IsConst>::operator->() const
+{
+	return &m_item->val;
+}
+
+template<class T, bool IsConst>
+ListNode<T>* ReversibleListIterator<T, IsConst>::getNode() const
+{
+	return m_item;
+}
+
+template<class T, bool IsConst>
+bool ReversibleListIterator<T, IsConst>::isReversed() const
+{
+	return m_reversed;
+}
+
+// reversible_list implementation
+
+template<class T, class Allocator>
+reversible_list<T, Allocator>::reversible_list() :
+	reversible_list(Allocator()) {}
+
+template<class T, class Allocator>
+reversible_list<T, Allocator>::reversible_list(const Allocator& alloc) :
+	m_list(alloc),
+	m_reversed(false) {}
+
+template<class T, class Allocator>
+template<class InputIt, typename Enabled>
+reversible_list<T, Allocator>::reversible_list(InputIt first, InputIt last, const Allocator& alloc) :
+	m_list(first, last, alloc),
+	m_reversed(false) {}
+
+template<class T, class Allocator>
+reversible_list<T, Allocator>::reversible_list(const reversible_list& other) :
+	m_list(other.begin(), other.end(), std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())),
+	m_reversed(false) {}
+
+template<class T, class Allocator>
+reversible_list<T, Allocator>::reversible_list(reversible_list&& other) :
+	m_list(std::move(other.m_list)),
+	m_reversed(other.m_reversed) {}
+
+template<class T, class Allocator>
+reversible_list<T, Allocator>::reversible_list(std::initializer_list<T> init, const Allocator& alloc) :
+	m_list(init, alloc),
+	m_reversed(false) {}
+
+template<class T, class Allocator>
+reversible_list<T, Allocator>& reversible_list<T, Allocator>::operator=(const reversible_list& other)
+{
+	if (this != &other)
+	{
+		m_list.assign(other.begin(), other.end());
+		m_reversed = false;
+	}
+	return *this;
+}
+
+template<class T, class Allocator>
+reversible_list<T, Allocator>& reversible_list<T, Allocator>::operator=(reversible_list&& other)
+{
+	if (this != &other)
+	{
+		m_list.clear();
+		m_list.splice(m_list.end(), other.m_list);
+		m_reversed = other.m_reversed;
+		other.m_reversed = false;
+	}
+	return *this;
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::allocator_type reversible_list<T, Allocator>::get_allocator() const
+{
+	return m_list.get_allocator();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::reference reversible_list<T, Allocator>::front()
+{
+	return *begin();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::const_reference reversible_list<T, Allocator>::front() const
+{
+	return *begin();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::reference reversible_list<T, Allocator>::back()
+{
+	return *rbegin();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::const_reference reversible_list<T, Allocator>::back() const
+{
+	return *rbegin();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::iterator reversible_list<T, Allocator>::begin() noexcept
+{
+	return iterator(m_reversed ? headNode()->prev : headNode()->next, m_reversed);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::const_iterator reversible_list<T, Allocator>::begin() const noexcept
+{
+	return const_iterator(m_reversed ? headNode()->prev : headNode()->next, m_reversed);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::const_iterator reversible_list<T, Allocator>::cbegin() const noexcept
+{
+	return begin();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::iterator reversible_list<T, Allocator>::end() noexcept
+{
+	return iterator(headNode(), m_reversed);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::const_iterator reversible_list<T, Allocator>::end() const noexcept
+{
+	return const_iterator(headNode(), m_reversed);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::const_iterator reversible_list<T, Allocator>::cend() const noexcept
+{
+	return end();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::reverse_iterator reversible_list<T, Allocator>::rbegin() noexcept
+{
+	return reverse_iterator(m_reversed ? headNode()->next : headNode()->prev, !m_reversed);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::const_reverse_iterator reversible_list<T, Allocator>::rbegin() const noexcept
+{
+	return const_reverse_iterator(m_reversed ? headNode()->next : headNode()->prev, !m_reversed);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::reverse_iterator reversible_list<T, Allocator>::rend() noexcept
+{
+	return reverse_iterator(headNode(), !m_reversed);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::const_reverse_iterator reversible_list<T, Allocator>::rend() const noexcept
+{
+	return const_reverse_iterator(headNode(), !m_reversed);
+}
+
+template<class T, class Allocator>
+bool reversible_list<T, Allocator>::empty() const noexcept
+{
+	return m_list.empty();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::size_type reversible_list<T, Allocator>::size() const noexcept
+{
+	return m_list.size();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::size_type reversible_list<T, Allocator>::max_size() const noexcept
+{
+	return m_list.max_size();
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::clear() noexcept
+{
+	m_list.clear();
+	m_reversed = false;
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::iterator reversible_list<T, Allocator>::insert(const_iterator pos, const value_type& value)
+{
+	return emplace(pos, value);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::iterator reversible_list<T, Allocator>::insert(const_iterator pos, value_type&& value)
+{
+	return emplace(pos, std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename reversible_list<T, Allocator>::iterator reversible_list<T, Allocator>::emplace(const_iterator pos, Args&&... args)
+{
+	return iterator(m_list.emplace(physicalPos(pos), std::forward<Args>(args)...).getNode(), m_reversed);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::iterator reversible_list<T, Allocator>::erase(const_iterator pos)
+{
+	list_node_type *next = m_reversed ? pos.getNode()->prev : pos.getNode()->next;
+	m_list.erase(typename list_type::const_iterator(pos.getNode()));
+	return iterator(next, m_reversed);
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::iterator reversible_list<T, Allocator>::erase(const_iterator first, const_iterator last)
+{
+	if (!m_reversed)
+		return iterator(m_list.erase(typename list_type::const_iterator(first.getNode()), typename list_type::const_iterator(last.getNode())).getNode(), false);
+	// Logically [first, last) is physically (last, first]
+	m_list.erase(physicalPos(last), physicalPos(first));
+	return iterator(last.getNode(), true);
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::push_front(const value_type& value)
+{
+	emplace_front(value);
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::push_front(value_type&& value)
+{
+	emplace_front(std::move(value));
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::push_back(const value_type& value)
+{
+	emplace_back(value);
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::push_back(value_type&& value)
+{
+	emplace_back(std::move(value));
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename reversible_list<T, Allocator>::reference reversible_list<T, Allocator>::emplace_front(Args&&... args)
+{
+	return m_reversed ? m_list.emplace_back(std::forward<Args>(args)...) : m_list.emplace_front(std::forward<Args>(args)...);
+}
+
+template<class T, class Allocator>
+template<class... Args>
+typename reversible_list<T, Allocator>::reference reversible_list<T, Allocator>::emplace_back(Args&&... args)
+{
+	return m_reversed ? m_list.emplace_front(std::forward<Args>(args)...) : m_list.emplace_back(std::forward<Args>(args)...);
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::pop_front()
+{
+	if (m_reversed)
+		m_list.pop_back();
+	else
+		m_list.pop_front();
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::pop_back()
+{
+	if (m_reversed)
+		m_list.pop_front();
+	else
+		m_list.pop_back();
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::swap(reversible_list& other)
+{
+	m_list.swap(other.m_list);
+	std::swap(m_reversed, other.m_reversed);
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::reverse() noexcept
+{
+	m_reversed = !m_reversed;
+}
+
+template<class T, class Allocator>
+bool reversible_list<T, Allocator>::is_reversed() const noexcept
+{
+	return m_reversed;
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::normalize() noexcept
+{
+	if (!m_reversed)
+		return;
+	m_list.reverse();
+	m_reversed = false;
+}
+
+template<class T, class Allocator>
+void reversible_list<T, Allocator>::sort()
+{
+	sort([](const T& left, const T& right) { return left < right; });
+}
+
+template<class T, class Allocator>
+template<class Compare>
+void reversible_list<T, Allocator>::sort(Compare comp)
+{
+	normalize();
+	m_list.sort(comp);
+}
+
+template<class T, class Allocator>
+ListNode<T>* reversible_list<T, Allocator>::headNode() const
+{
+	return m_list.end().getNode();
+}
+
+template<class T, class Allocator>
+typename reversible_list<T, Allocator>::list_type::const_iterator reversible_list<T, Allocator>::physicalPos(const_iterator pos) const
+{
+	// Inserting before pos in reversed order means inserting after it in
+	// the underlying list
+	return typename list_type::const_iterator(m_reversed ? pos.getNode()->next : pos.getNode());
+}
+
+template<class T, class Alloc>
+bool operator==(const reversible_list<T, Alloc>& left, const reversible_list<T, Alloc>& right)
+{
+	return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin());
+}
+
+template<class T, class Alloc>
+bool operator!=(const reversible_list<T, Alloc>& left, const reversible_list<T, Alloc>& right)
+{
+	return !(left == right);
+}
+
+}
+
+namespace std
+{
+
+template<class T, class Alloc>
+void swap(blk::reversible_list<T, Alloc>& left, blk::reversible_list<T, Alloc>& right)
+{
+	left.swap(right);
+}
+
+}
@@ -0,0 +1,312 @@
+#include "../include/small_list.h"
+
+namespace blk
+{
+
+// SmallListAllocator implementation
+
+template<class T, class Allocator>
+SmallListAllocator<T, Allocator>::SmallListAllocator() :
+	m_arena(nullptr) {}
+
+template<class T, class Allocator>
+SmallListAllocator<T, Allocator>::SmallListAllocator(SmallListArena* arena, const Allocator& upstream) :
+	m_arena(arena),
+	m_upstream(upstream) {}
+
+template<class T, class Allocator>
+template<class U>
+SmallListAllocator<T, Allocator>::SmallListAllocator(const SmallListAllocator<U, Allocator>& other) :
+	m_arena(other.arena()),
+	m_upstream(other.upstream()) {}
+
+template<class T, class Allocator>
+T* SmallListAllocator<T, Allocator>::allocate(size_t cnt)
+{
+	if (m_arena && m_arena->freeSlot && cnt == 1 && sizeof(T) <= m_arena->slotSize && alignof(T) <= m_arena->slotAlign)
+	{
+		void *slot = m_arena->freeSlot;
+		m_arena->freeSlot = *static_cast<void**>(slot);
+		m_arena->used++;
+		return static_cast<T*>(slot);
+	}
+	upstream_allocator alloc(m_upstream);
+	return upstream_traits::allocate(alloc, cnt);
+}
+
+template<class T, class Allocator>
+void SmallListAllocator<T, Allocator>::deallocate(T* ptr, size_t cnt)
+{
+	if (owns(ptr))
+	{
+		*reinterpret_cast<void**>(ptr) = m_arena->freeSlot;
+		m_arena->freeSlot = ptr;
+		m_arena->used--;
+		return;
+	}
+	upstream_allocator alloc(m_upstream);
+	upstream_traits::deallocate(alloc, ptr, cnt);
+}
+
+template<class T, class Allocator>
+bool SmallListAllocator<T, Allocator>::owns(const void* ptr) const
+{
+	auto bytes = static_cast<const char*>(ptr);
+	return m_arena && std::less_equal<const char*>()(m_arena->begin, bytes) && std::less<const char*>()(bytes, m_arena->end);
+}
+
+template<class T, class Allocator>
+SmallListArena* SmallListAllocator<T, Allocator>::arena() const
+{
+	return m_arena;
+}
+
+template<class T, class Allocator>
+const typename SmallListAllocator<T, Allocator>::upstream_type& SmallListAllocator<T, Allocator>::upstream() const
+{
+	return m_upstream;
+}
+
+template<class T, class U, class Allocator>
+bool operator==(const SmallListAllocator<T, Allocator>& left, const SmallListAllocator<U, Allocator>& right)
+{
+	return left.arena() == right.arena() && left.upstream() == right.upstream();
+}
+
+template<class T, class U, class Allocator>
+bool operator!=(const SmallListAllocator<T, Allocator>& left, const SmallListAllocator<U, Allocator>& right)
+{
+	return !(left == right);
+}
+
+template<class T, class Allocator>
+bool ListNodeTransfer<SmallListAllocator<T, Allocator>>::canRelinkAll(const SmallListAllocator<T, Allocator>& to, const SmallListAllocator<T, Allocator>& from)
+{
+	return to == from;
+}
+
+template<class T, class Allocator>
+bool ListNodeTransfer<SmallListAllocator<T, Allocator>>::canRelink(const SmallListAllocator<T, Allocator>& to, const SmallListAllocator<T, Allocator>& from, const void* node)
+{
+	if (to == from)
+		return true;
+	return !from.owns(node) && to.upstream() == from.upstream();
+}
+
+// SmallListStorage implementation
+
+template<class Node, size_t Count>
+SmallListStorage<Node, Count>::SmallListStorage()
+{
+	m_arena.begin = reinterpret_cast<char*>(&m_slots[0]);
+	m_arena.end = reinterpret_cast<char*>(&m_slots[0] + Count);
+	m_arena.slotSize = sizeof(m_slots[0]);
+	m_arena.slotAlign = alignof(Node);
+	m_arena.used = 0;
+	m_arena.freeSlot = nullptr;
+	for (size_t i = Count; i > 0; i--)
+	{
+		*reinterpret_cast<void**>(&m_slots[i - 1]) = m_arena.freeSlot;
+		m_arena.freeSlot = &m_slots[i - 1];
+	}
+}
+
+// small_list implementation
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>::small_list() :
+	small_list(Allocator()) {}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>::small_list(const Allocator& alloc) :
+	storage_type(),
+	base_type(makeAllocator(alloc)) {}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>::small_list(size_type count, const value_type& value, const Allocator& alloc) :
+	storage_type(),
+	base_type(count, value, makeAllocator(alloc)) {}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>::small_list(size_type count, const Allocator& alloc) :
+	storage_type(),
+	base_type(count, makeAllocator(alloc)) {}
+
+template<class T, size_t N, class Allocator>
+template<class InputIt, typename Enabled>
+small_list<T, N, Allocator>::small_list(InputIt first, InputIt last, const Allocator& alloc) :
+	storage_type(),
+	base_type(first, last, makeAllocator(alloc)) {}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>::small_list(const small_list& other) :
+	small_list(other, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator().upstream())) {}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>::small_list(const small_list& other, const Allocator& alloc) :
+	storage_type(),
+	base_type(other, makeAllocator(alloc)) {}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>::small_list(small_list&& other) :
+	small_list(std::move(other), other.get_allocator().upstream()) {}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>::small_list(small_list&& other, const Allocator& alloc) :
+	small_list(alloc)
+{
+	this->splice(this->end(), other);
+}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>::small_list(std::initializer_list<T> init, const Allocator& alloc) :
+	storage_type(),
+	base_type(init, makeAllocator(alloc)) {}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>& small_list<T, N, Allocator>::operator=(const small_list& other)
+{
+	if (this != &other)
+		this->assign(other.begin(), other.end());
+	return *this;
+}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>& small_list<T, N, Allocator>::operator=(small_list&& other)
+{
+	if (this != &other)
+	{
+		this->clear();
+		this->splice(this->end(), other);
+	}
+	return *this;
+}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator>& small_list<T, N, Allocator>::operator=(std::initializer_list<T> init)
+{
+	this->assign(init);
+	return *this;
+}
+
+template<class T, size_t N, class Allocator>
+typename small_list<T, N, Allocator>::iterator small_list<T, N, Allocator>::insert(const_iterator pos, node_type&& handle)
+{
+	if (handle.empty())
+		return this->end();
+	if (!(handle.get_allocator() == this->get_allocator().upstream()))
+	{
+		iterator res = this->emplace(pos, std::move(handle.value()));
+		handle = node_type();
+		return res;
+	}
+	ListNode<T> *node = handle.release();
+	this->attachNode(node, pos.getNode());
+	return iterator(node);
+}
+
+template<class T, size_t N, class Allocator>
+typename small_list<T, N, Allocator>::node_type small_list<T, N, Allocator>::extract(const_iterator pos)
+{
+	return extract_upstream(pos);
+}
+
+template<class T, size_t N, class Allocator>
+typename small_list<T, N, Allocator>::upstream_node_type small_list<T, N, Allocator>::extract_upstream(const_iterator pos)
+{
+	Allocator upstream = this->get_allocator().upstream();
+	if (!this->get_allocator().owns(pos.getNode()))
+		return upstream_node_type(base_type::extract(pos).release(), upstream);
+
+	using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<ListNode<T>>;
+	node_allocator_type nodeAlloc(upstream);
+	ListNode<T> *node = std::allocator_traits<node_allocator_type>::allocate(nodeAlloc, 1);
+	upstream_node_type res(node, upstream);
+	Allocator alloc(upstream);
+	try
+	{
+		std::allocator_traits<Allocator>::construct(alloc, &node->val, std::move(pos.getNode()->val));
+	}
+	catch (...)
+	{
+		res.release();
+		std::allocator_traits<node_allocator_type>::deallocate(nodeAlloc, node, 1);
+		throw;
+	}
+	this->erase(pos);
+	return res;
+}
+
+template<class T, size_t N, class Allocator>
+void small_list<T, N, Allocator>::swap(small_list& other)
+{
+	if (this == &other)
+		return;
+	small_list tmp(this->get_allocator().upstream());
+	tmp.splice(tmp.end(), *this);
+	this->splice(this->end(), other);
+	other.splice(other.end(), tmp);
+}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator> small_list<T, N, Allocator>::split(const_iterator pos)
+{
+	small_list tail(this->get_allocator().upstream());
+	tail.splice(tail.end(), *this, pos, this->cend());
+	return tail;
+}
+
+template<class T, size_t N, class Allocator>
+small_list<T, N, Allocator> small_list<T, N, Allocator>::split(const_iterator pos, size_type count)
+{
+	small_list tail(this->get_allocator().upstream());
+	tail.commonSplice(tail.cend(), *this, pos, this->cend(), count);
+	return tail;
+}
+
+template<class T, size_t N, class Allocator>
+std::vector<small_list<T, N, Allocator>> small_list<T, N, Allocator>::split_into(size_type k)
+{
+	std::vector<small_list> parts;
+	if (k == 0)
+		return parts;
+	parts.reserve(k);
+	for (size_type i = 0; i < k; i++)
+		parts.emplace_back(this->get_allocator().upstream());
+
+	const size_type total = this->size();
+	for (size_type i = 0; i < k; i++)
+	{
+		size_type count = total / k + (i < total % k ? 1 : 0);
+		const_iterator last = this->cbegin();
+		for (size_type j = 0; j < count; j++)
+			++last;
+		parts[i].commonSplice(parts[i].cend(), *this, this->cbegin(), last, count);
+	}
+	return parts;
+}
+
+template<class T, size_t N, class Allocator>
+typename small_list<T, N, Allocator>::size_type small_list<T, N, Allocator>::spilled() const noexcept
+{
+	return this->size() - (this->m_arena.used - 1);
+}
+
+template<class T, size_t N, class Allocator>
+typename small_list<T, N, Allocator>::allocator_type small_list<T, N, Allocator>::makeAllocator(const Allocator& upstream)
+{
+	return allocator_type(&this->m_arena, upstream);
+}
+
+}
+
+namespace std
+{
+
+template<class T, size_t N, class Allocator>
+void swap(blk::small_list<T, N, Allocator>& left, blk::small_list<T, N, Allocator>& right)
+{
+	left.swap(right);
+}
+
+}
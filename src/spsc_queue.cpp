@@ -0,0 +1,160 @@
+#include "../include/spsc_queue.h"
+
+namespace blk
+{
+
+// spsc_queue implementation
+
+template<class T, size_t Capacity>
+spsc_queue<T, Capacity>::spsc_queue() noexcept :
+	m_head(0),
+	m_cachedTail(0),
+	m_tail(0),
+	m_cachedHead(0) {}
+
+template<class T, size_t Capacity>
+spsc_queue<T, Capacity>::~spsc_queue()
+{
+	size_type tail = m_tail.load(std::memory_order_acquire);
+	for (size_type head = m_head.load(std::memory_order_relaxed); head != tail; ++head)
+		slot(head)->~T();
+}
+
+template<class T, size_t Capacity>
+constexpr typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::capacity() noexcept
+{
+	return Capacity;
+}
+
+template<class T, size_t Capacity>
+bool spsc_queue<T, Capacity>::empty() const noexcept
+{
+	return size() == 0;
+}
+
+template<class T, size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::size() const noexcept
+{
+	// The head is read first: the tail never falls behind it
+	size_type head = m_head.load(std::memory_order_acquire);
+	size_type tail = m_tail.load(std::memory_order_acquire);
+	return tail - head < Capacity ? tail - head : Capacity;
+}
+
+template<class T, size_t Capacity>
+bool spsc_queue<T, Capacity>::try_push(const value_type& value)
+{
+	return try_emplace(value);
+}
+
+template<class T, size_t Capacity>
+bool spsc_queue<T, Capacity>::try_push(value_type&& value)
+{
+	return try_emplace(std::move(value));
+}
+
+template<class T, size_t Capacity>
+template<class... Args>
+bool spsc_queue<T, Capacity>::try_emplace(Args&&... args)
+{
+	size_type tail = m_tail.load(std::memory_order_relaxed);
+	if (freeSlots(tail, 1) == 0)
+		return false;
+	new (slot(tail)) T(std::forward<Args>(args)...);
+	m_tail.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+template<class T, size_t Capacity>
+template<class InputIt>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::try_push_n(InputIt first, size_type count)
+{
+	size_type tail = m_tail.load(std::memory_order_relaxed);
+	size_type free = freeSlots(tail, count);
+	if (count > free)
+		count = free;
+	size_type pushed = 0;
+	try
+	{
+		for (; pushed < count; ++pushed, ++first)
+			new (slot(tail + pushed)) T(*first);
+	}
+	catch (...)
+	{
+		m_tail.store(tail + pushed, std::memory_order_release);
+		throw;
+	}
+	m_tail.store(tail + count, std::memory_order_release);
+	return count;
+}
+
+template<class T, size_t Capacity>
+bool spsc_queue<T, Capacity>::try_pop(value_type& value)
+{
+	size_type head = m_head.load(std::memory_order_relaxed);
+	if (usedSlots(head, 1) == 0)
+		return false;
+	T* item = slot(head);
+	value = std::move(*item);
+	item->~T();
+	m_head.store(head + 1, std::memory_order_release);
+	return true;
+}
+
+template<class T, size_t Capacity>
+template<class OutputIt>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::try_pop_n(OutputIt out, size_type count)
+{
+	size_type head = m_head.load(std::memory_order_relaxed);
+	size_type used = usedSlots(head, count);
+	if (count > used)
+		count = used;
+	size_type popped = 0;
+	try
+	{
+		for (; popped < count; ++popped, ++out)
+		{
+			T* item = slot(head + popped);
+			*out = std::move(*item);
+			item->~T();
+		}
+	}
+	catch (...)
+	{
+		m_head.store(head + popped, std::memory_order_release);
+		throw;
+	}
+	m_head.store(head + count, std::memory_order_release);
+	return count;
+}
+
+template<class T, size_t Capacity>
+typename spsc_queue<T, Capacity>::value_type* spsc_queue<T, Capacity>::front() noexcept
+{
+	size_type head = m_head.load(std::memory_order_relaxed);
+	return usedSlots(head, 1) == 0 ? nullptr : slot(head);
+}
+
+template<class T, size_t Capacity>
+typename spsc_queue<T, Capacity>::value_type* spsc_queue<T, Capacity>::slot(size_type index) noexcept
+{
+	return reinterpret_cast<T*>(&m_slots[index & (Capacity - 1)]);
+}
+
+template<class T, size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::freeSlots(size_type tail, size_type wanted) noexcept
+{
+	if (Capacity - (tail - m_cachedHead) < wanted)
+		m_cachedHead = m_head.load(std::memory_order_acquire);
+	return Capacity - (tail - m_cachedHead);
+}
+
+template<class T, size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::usedSlots(size_type head, size_type wanted) noexcept
+{
+	if (m_cachedTail - head < wanted)
+		m_cachedTail = m_tail.load(std::memory_order_acquire);
+	return m_cachedTail - head;
+}
+
+}
@@ -0,0 +1,123 @@
+#include "../include/static_list.h"
+
+namespace blk
+{
+
+// Overflow policies implementation
+
+inline void throw_on_overflow::overflow()
+{
+	throw std::length_error("static_list capacity exceeded");
+}
+
+inline void terminate_on_overflow::overflow() noexcept
+{
+	std::terminate();
+}
+
+// StaticListOverflowAllocator implementation
+
+template<class T, class OverflowPolicy>
+template<class U>
+StaticListOverflowAllocator<T, OverflowPolicy>::StaticListOverflowAllocator(const StaticListOverflowAllocator<U, OverflowPolicy>&) {}
+
+template<class T, class OverflowPolicy>
+T* StaticListOverflowAllocator<T, OverflowPolicy>::allocate(size_t)
+{
+	OverflowPolicy::overflow();
+	return nullptr;
+}
+
+template<class T, class OverflowPolicy>
+void StaticListOverflowAllocator<T, OverflowPolicy>::deallocate(T*, size_t) {}
+
+template<class T, class U, class OverflowPolicy>
+bool operator==(const StaticListOverflowAllocator<T, OverflowPolicy>&, const StaticListOverflowAllocator<U, OverflowPolicy>&)
+{
+	return true;
+}
+
+template<class T, class U, class OverflowPolicy>
+bool operator!=(const StaticListOverflowAllocator<T, OverflowPolicy>&, const StaticListOverflowAllocator<U, OverflowPolicy>&)
+{
+	return false;
+}
+
+// static_list implementation
+
+template<class T, size_t N, class OverflowPolicy>
+static_list<T, N, OverflowPolicy>::static_list(size_type count, const value_type& value) :
+	base_type(count, value) {}
+
+template<class T, size_t N, class OverflowPolicy>
+static_list<T, N, OverflowPolicy>::static_list(size_type count) :
+	base_type(count) {}
+
+template<class T, size_t N, class OverflowPolicy>
+template<class InputIt, typename Enabled>
+static_list<T, N, OverflowPolicy>::static_list(InputIt first, InputIt last) :
+	base_type(first, last) {}
+
+template<class T, size_t N, class OverflowPolicy>
+static_list<T, N, OverflowPolicy>::static_list(std::initializer_list<T> init) :
+	base_type(init) {}
+
+template<class T, size_t N, class OverflowPolicy>
+static_list<T, N, OverflowPolicy>& static_list<T, N, OverflowPolicy>::operator=(std::initializer_list<T> init)
+{
+	base_type::operator=(init);
+	return *this;
+}
+
+template<class T, size_t N, class OverflowPolicy>
+constexpr typename static_list<T, N, OverflowPolicy>::size_type static_list<T, N, OverflowPolicy>::capacity() noexcept
+{
+	return N;
+}
+
+template<class T, size_t N, class OverflowPolicy>
+constexpr typename static_list<T, N, OverflowPolicy>::size_type static_list<T, N, OverflowPolicy>::max_size() noexcept
+{
+	return N;
+}
+
+template<class T, size_t N, class OverflowPolicy>
+bool static_list<T, N, OverflowPolicy>::full() const noexcept
+{
+	return this->size() == N;
+}
+
+template<class T, size_t N, class OverflowPolicy>
+template<class... Args>
+typename static_list<T, N, OverflowPolicy>::iterator static_list<T, N, OverflowPolicy>::try_emplace(const_iterator pos, Args&&... args)
+{
+	if (full())
+		return this->end();
+	return this->emplace(pos, std::forward<Args>(args)...);
+}
+
+template<class T, size_t N, class OverflowPolicy>
+bool static_list<T, N, OverflowPolicy>::try_push_back(const value_type& value)
+{
+	return try_emplace(this->end(), value) != this->end();
+}
+
+template<class T, size_t N, class OverflowPolicy>
+bool static_list<T, N, OverflowPolicy>::try_push_back(value_type&& value)
+{
+	return try_emplace(this->end(), std::move(value)) != this->end();
+}
+
+template<class T, size_t N, class OverflowPolicy>
+bool static_list<T, N, OverflowPolicy>::try_push_front(const value_type& value)
+{
+	return try_emplace(this->begin(), value) != this->end();
+}
+
+template<class T, size_t N, class OverflowPolicy>
+bool static_list<T, N, OverflowPolicy>::try_push_front(value_type&& value)
+{
+	return try_emplace(this->begin(), std::move(value)) != this->end();
+}
+
+}
@@ -0,0 +1,215 @@
+#include "../include/timer_wheel.h"
+
+namespace blk
+{
+
+// TimerWheelEntry implementation
+
+template<class Payload>
+template<class... Args>
+TimerWheelEntry<Payload>::TimerWheelEntry(std::uint64_t due, size_t bucket, Args&&... args) :
+	payload(std::forward<Args>(args)...),
+	due(due),
+	bucket(bucket) {}
+
+template<class Payload>
+std::uint64_t TimerWheelEntry<Payload>::deadline() const noexcept
+{
+	return due;
+}
+
+// timer_wheel implementation
+
+template<class Payload, class Allocator>
+timer_wheel<Payload, Allocator>::timer_wheel(const Allocator& alloc) :
+	timer_wheel(0, alloc) {}
+
+template<class Payload, class Allocator>
+timer_wheel<Payload, Allocator>::timer_wheel(tick_type start, const Allocator& alloc) :
+	m_cascade(entry_allocator_type(alloc)),
+	m_size(0),
+	m_now(start)
+{
+	m_buckets.reserve(levels * slots);
+	for (size_type i = 0; i < levels * slots; i++)
+		m_buckets.emplace_back(entry_allocator_type(alloc));
+	for (size_type level = 0; level < levels; level++)
+		m_levelSize[level] = 0;
+}
+
+template<class Payload, class Allocator>
+typename timer_wheel<Payload, Allocator>::allocator_type timer_wheel<Payload, Allocator>::get_allocator() const
+{
+	return allocator_type(m_cascade.get_allocator());
+}
+
+template<class Payload, class Allocator>
+bool timer_wheel<Payload, Allocator>::empty() const noexcept
+{
+	return m_size == 0;
+}
+
+template<class Payload, class Allocator>
+typename timer_wheel<Payload, Allocator>::size_type timer_wheel<Payload, Allocator>::size() const noexcept
+{
+	return m_size;
+}
+
+template<class Payload, class Allocator>
+typename timer_wheel<Payload, Allocator>::tick_type timer_wheel<Payload, Allocator>::now() const noexcept
+{
+	return m_now;
+}
+
+template<class Payload, class Allocator>
+typename timer_wheel<Payload, Allocator>::handle timer_wheel<Payload, Allocator>::schedule(tick_type delay, const Payload& payload)
+{
+	return emplace(delay, payload);
+}
+
+template<class Payload, class Allocator>
+typename timer_wheel<Payload, Allocator>::handle timer_wheel<Payload, Allocator>::schedule(tick_type delay, Payload&& payload)
+{
+	return emplace(delay, std::move(payload));
+}
+
+template<class Payload, class Allocator>
+template<class... Args>
+typename timer_wheel<Payload, Allocator>::handle timer_wheel<Payload, Allocator>::emplace(tick_type delay, Args&&... args)
+{
+	tick_type due = m_now + (delay > 0 ? delay : 1);
+	size_type bucket = bucketFor(due);
+	list_type& target = m_buckets[bucket];
+	handle res = target.emplace(target.end(), due, bucket, std::forward<Args>(args)...);
+	m_levelSize[bucket / slots]++;
+	m_size++;
+	return res;
+}
+
+template<class Payload, class Allocator>
+void timer_wheel<Payload, Allocator>::reschedule(handle timer, tick_type delay)
+{
+	size_type from = timer->bucket;
+	timer->due = m_now + (delay > 0 ? delay : 1);
+	size_type bucket = bucketFor(timer->due);
+	m_buckets[bucket].splice(m_buckets[bucket].end(), m_buckets[from], timer);
+	timer->bucket = bucket;
+	m_levelSize[from / slots]--;
+	m_levelSize[bucket / slots]++;
+}
+
+template<class Payload, class Allocator>
+void timer_wheel<Payload, Allocator>::cancel(handle timer)
+{
+	size_type bucket = timer->bucket;
+	m_buckets[bucket].erase(timer);
+	m_levelSize[bucket / slots]--;
+	m_size--;
+}
+
+template<class Payload, class Allocator>
+void timer_wheel<Payload, Allocator>::clear() noexcept
+{
+	for (list_type& bucket : m_buckets)
+		bucket.clear();
+	for (size_type level = 0; level < levels; level++)
+		m_levelSize[level] = 0;
+	m_size = 0;
+}
+
+template<class Payload, class Allocator>
+typename timer_wheel<Payload, Allocator>::size_type timer_wheel<Payload, Allocator>::advance(tick_type ticks, list_type& expired)
+{
+	const size_type before = expired.size();
+	const tick_type target = m_now + ticks;
+	while (m_now != target)
+	{
+		// With the lowest `empty` levels vacant nothing happens until the next
+		// cascade of the first occupied level, so jump right in front of it
+		size_type vacant = 0;
+		while (vacant < levels && m_levelSize[vacant] == 0)
+			vacant++;
+		if (vacant == levels)
+		{
+			m_now = target;
+			break;
+		}
+		if (vacant > 0)
+		{
+			tick_type skipTo = m_now | levelMask(vacant);
+			if (target - m_now <= skipTo - m_now)
+			{
+				m_now = target;
+				break;
+			}
+			m_now = skipTo;
+		}
+
+		m_now++;
+		// Higher levels go first, so a timer re-filed from level 2 into a
+		// level 1 bucket that cascades on this tick is not left behind
+		size_type top = 0;
+		while (top + 1 < levels && (m_now & levelMask(top + 1)) == 0)
+			top++;
+		for (size_type level = top; level > 0; level--)
+			cascade(level, expired);
+
+		list_type& due = m_buckets[m_now & (slots - 1)];
+		m_levelSize[0] -= due.size();
+		m_size -= due.size();
+		expired.splice(expired.end(), due);
+	}
+	return expired.size() - before;
+}
+
+template<class Payload, class Allocator>
+typename timer_wheel<Payload, Allocator>::tick_type timer_wheel<Payload, Allocator>::levelMask(size_type level)
+{
+	return (tick_type(1) << (slotBits * level)) - 1;
+}
+
+template<class Payload, class Allocator>
+typename timer_wheel<Payload, Allocator>::size_type timer_wheel<Payload, Allocator>::bucketFor(tick_type due) const
+{
+	tick_type distance = due - m_now;
+	for (size_type level = 0; level + 1 < levels; level++)
+	{
+		if (distance <= levelMask(level + 1))
+			return level * slots + ((due >> (slotBits * level)) & (slots - 1));
+	}
+	// Timers beyond the last level wait in the last bucket they can reach and
+	// are re-filed when it cascades
+	const size_type last = levels - 1;
+	if (distance > levelMask(levels))
+		due = m_now + levelMask(levels);
+	return last * slots + ((due >> (slotBits * last)) & (slots - 1));
+}
+
+template<class Payload, class Allocator>
+void timer_wheel<Payload, Allocator>::file(handle timer, list_type& from, list_type& expired)
+{
+	if (timer->due <= m_now)
+	{
+		expired.splice(expired.end(), from, timer);
+		m_size--;
+		return;
+	}
+	size_type bucket = bucketFor(timer->due);
+	m_buckets[bucket].splice(m_buckets[bucket].end(), from, timer);
+	timer->bucket = bucket;
+	m_levelSize[bucket / slots]++;
+}
+
+template<class Payload, class Allocator>
+void timer_wheel<Payload, Allocator>::cascade(size_type level, list_type& expired)
+{
+	list_type& bucket = m_buckets[level * slots + ((m_now >> (slotBits * level)) & (slots - 1))];
+	if (bucket.empty())
+		return;
+	m_levelSize[level] -= bucket.size();
+	m_cascade.splice(m_cascade.end(), bucket);
+	while (!m_cascade.empty())
+		file(m_cascade.begin(), m_cascade, expired);
+}
+
+}
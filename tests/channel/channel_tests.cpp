@@ -0,0 +1,114 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "../../include/channel.h"
+#include "../test_class.h"
+
+BOOST_AUTO_TEST_SUITE(channel)
+
+BOOST_AUTO_TEST_CASE(push_pop_and_drain)
+{
+	blk::channel<TestClass> channel;
+	BOOST_CHECK(channel.capacity() == 0 && channel.empty());
+	BOOST_CHECK(channel.push(TestClass(0)));
+	BOOST_CHECK(channel.emplace(1));
+	blk::list<TestClass> batch;
+	batch.emplace_back(2);
+	batch.emplace_back(3);
+	BOOST_CHECK(channel.push_all(batch) && batch.empty());
+	BOOST_CHECK(channel.size() == 4);
+
+	TestClass value(-1);
+	BOOST_CHECK(channel.pop(value) && value.getValue() == 0);
+	blk::list<TestClass> out;
+	out.emplace_back(-1);
+	BOOST_CHECK(channel.drain(out) == 3 && channel.empty());
+	BOOST_CHECK(out.size() == 4 && out.back().getValue() == 3);
+	BOOST_CHECK(channel.try_drain(out) == 0 && !channel.try_pop(value));
+}
+
+BOOST_AUTO_TEST_CASE(close_fails_pushes_and_releases_consumers)
+{
+	blk::channel<TestClass> channel;
+	channel.push(TestClass(7));
+	channel.close();
+	BOOST_CHECK(channel.closed());
+
+	TestClass rejected(8);
+	BOOST_CHECK(!channel.push(std::move(rejected)) && rejected.getValue() == 8);
+	BOOST_CHECK(!channel.try_push(std::move(rejected)) && rejected.getValue() == 8);
+	blk::list<TestClass> batch;
+	batch.emplace_back(9);
+	BOOST_CHECK(!channel.push_all(batch) && batch.size() == 1);
+
+	TestClass value(-1);
+	BOOST_CHECK(channel.pop(value) && value.getValue() == 7);
+	BOOST_CHECK(!channel.pop(value));
+	BOOST_CHECK(channel.drain(batch) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(bounded_capacity)
+{
+	blk::channel<int> channel(2);
+	BOOST_CHECK(channel.try_push(1) && channel.try_push(2));
+	BOOST_CHECK(!channel.try_push(3) && channel.size() == 2);
+	blk::list<int> out;
+	BOOST_CHECK(channel.drain(out) == 2);
+
+	// A batch larger than the capacity goes into an empty channel
+	BOOST_CHECK(channel.push_all(blk::list<int> { 3, 4, 5 }));
+	BOOST_CHECK(channel.size() == 3 && !channel.try_push(6));
+}
+
+BOOST_AUTO_TEST_CASE(producers_wait_for_consumers)
+{
+	const int perProducer = 20000;
+	const size_t capacity = 8;
+	blk::channel<int> channel(capacity);
+	std::vector<std::thread> producers;
+	for (int p = 0; p < 2; ++p)
+		producers.emplace_back([&channel, p]
+		{
+			for (int i = 0; i < perProducer;)
+			{
+				if (i % 5 == 0 && i + 3 <= perProducer)
+				{
+					channel.push_all(blk::list<int> { p * perProducer + i, p * perProducer + i + 1, p * perProducer + i + 2 });
+					i += 3;
+				}
+				else
+					channel.push(p * perProducer + i++);
+			}
+		});
+
+	std::vector<int> next { 0, perProducer };
+	bool ordered = true;
+	size_t largest = 0;
+	int received = 0;
+	std::thread closer([&]
+	{
+		for (auto& producer : producers)
+			producer.join();
+		channel.close();
+	});
+	blk::list<int> batch;
+	while (channel.drain(batch) != 0)
+	{
+		largest = std::max(largest, batch.size());
+		for (int value : batch)
+		{
+			int& expected = next[value / perProducer];
+			ordered = ordered && value == expected++;
+			++received;
+		}
+		batch.clear();
+	}
+	closer.join();
+	BOOST_CHECK(ordered && received == 2 * perProducer);
+	BOOST_CHECK(largest <= capacity);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
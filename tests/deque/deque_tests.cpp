@@ -0,0 +1,132 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+#include "../../include/deque.h"
+#include "../test_class.h"
+#include "../test_allocator.h"
+
+BOOST_AUTO_TEST_SUITE(deque)
+
+BOOST_AUTO_TEST_CASE(push_and_pop_at_both_ends)
+{
+	blk::deque<int> deque;
+	BOOST_CHECK(deque.empty() && deque.begin() == deque.end());
+	const int count = static_cast<int>(blk::deque<int>::block_size) * 5 + 3;
+	for (int i = 0; i < count; ++i)
+	{
+		deque.push_back(i);
+		deque.push_front(-i - 1);
+	}
+	BOOST_REQUIRE(deque.size() == static_cast<size_t>(2 * count));
+	for (int i = 0; i < 2 * count; ++i)
+		BOOST_REQUIRE(deque[i] == i - count);
+	BOOST_CHECK(deque.front() == -count && deque.back() == count - 1);
+	BOOST_CHECK(deque.end() - deque.begin() == 2 * count);
+	BOOST_CHECK(*(deque.rbegin() + 1) == count - 2);
+	BOOST_CHECK_THROW(deque.at(2 * count), std::out_of_range);
+
+	while (deque.size() > 1)
+	{
+		deque.pop_front();
+		deque.pop_back();
+	}
+	BOOST_CHECK(deque.size() == 0 || deque.size() == 1);
+	deque.clear();
+	BOOST_CHECK(deque.empty());
+	deque.push_front(7);
+	BOOST_CHECK(deque.front() == 7 && deque.back() == 7);
+	deque.pop_back();
+	deque.shrink_to_fit();
+	BOOST_CHECK(deque.empty());
+}
+
+BOOST_AUTO_TEST_CASE(fifo_with_steady_length)
+{
+	blk::deque<TestClass> queue;
+	int next = 0;
+	for (; next < 100; ++next)
+		queue.emplace_back(next);
+	for (int expected = 0; expected < 100000; ++expected)
+	{
+		BOOST_REQUIRE(queue.front().getValue() == expected);
+		queue.pop_front();
+		queue.emplace_back(next++);
+	}
+	BOOST_CHECK(queue.size() == 100 && queue.back().getValue() == next - 1);
+}
+
+BOOST_AUTO_TEST_CASE(middle_insert_and_erase_match_std_deque)
+{
+	std::mt19937 rng(5);
+	blk::deque<std::string> deque;
+	std::deque<std::string> reference;
+	for (int step = 0; step < 3000; ++step)
+	{
+		size_t pos = reference.empty() ? 0 : rng() % (reference.size() + 1);
+		std::string value = std::to_string(step);
+		switch (rng() % 5)
+		{
+		case 0:
+		case 1:
+			deque.insert(deque.begin() + pos, value);
+			reference.insert(reference.begin() + pos, value);
+			break;
+		case 2:
+			deque.emplace(deque.cbegin() + pos, 3, 'x');
+			reference.emplace(reference.begin() + pos, 3, 'x');
+			break;
+		default:
+			if (!reference.empty())
+			{
+				size_t first = rng() % reference.size();
+				size_t count = std::min<size_t>(rng() % 4, reference.size() - first);
+				auto it = deque.erase(deque.begin() + first, deque.begin() + first + count);
+				reference.erase(reference.begin() + first, reference.begin() + first + count);
+				BOOST_REQUIRE(it - deque.begin() == static_cast<std::ptrdiff_t>(first));
+			}
+		}
+		BOOST_REQUIRE(deque.size() == reference.size());
+	}
+	BOOST_CHECK(std::equal(deque.begin(), deque.end(), reference.begin()));
+	deque.erase(deque.begin());
+	reference.erase(reference.begin());
+	BOOST_CHECK(std::equal(deque.cbegin(), deque.cend(), reference.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(copy_move_and_allocators)
+{
+	blk::deque<int, TestAllocator<int>> first({ 1, 2, 3 }, TestAllocator<int>(0));
+	blk::deque<int, TestAllocator<int>> copy(first);
+	BOOST_CHECK(copy == first && copy.get_allocator().getValue() == 0);
+
+	blk::deque<int, TestAllocator<int>> moved(std::move(copy));
+	BOOST_CHECK(moved == first && copy.empty());
+	copy.push_back(4);
+	BOOST_CHECK(copy.size() == 1);
+
+	// Allocators do not propagate, so assignments keep their own
+	blk::deque<int, TestAllocator<int>> other({ 9 }, TestAllocator<int>(1));
+	other = first;
+	BOOST_CHECK(other == first && other.get_allocator().getValue() == 1);
+	blk::deque<int, TestAllocator<int>> target(TestAllocator<int>(2));
+	target = std::move(moved);
+	BOOST_CHECK(target == first && target.get_allocator().getValue() == 2);
+	blk::deque<int, TestAllocator<int>> adopted(std::move(target), TestAllocator<int>(2));
+	BOOST_CHECK(adopted == first && target.empty());
+
+	blk::deque<int> left { 1, 2 };
+	blk::deque<int> right { 3 };
+	std::swap(left, right);
+	BOOST_CHECK(left.size() == 1 && right.size() == 2 && !(left < right));
+	left = { 5, 6, 7 };
+	left.resize(5, 1);
+	BOOST_CHECK((std::vector<int>(left.begin(), left.end()) == std::vector<int> { 5, 6, 7, 1, 1 }));
+	left.resize(2);
+	BOOST_CHECK(left == blk::deque<int>({ 5, 6 }) && left != right);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
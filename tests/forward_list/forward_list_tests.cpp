@@ -0,0 +1,139 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <iterator>
+#include "../../include/forward_list.h"
+#include "../test_class.h"
+#include "../test_allocator.h"
+
+BOOST_AUTO_TEST_SUITE(forward_list)
+
+BOOST_AUTO_TEST_CASE(node_has_no_prev_link)
+{
+	BOOST_CHECK(sizeof(blk::ForwardListNode<int>) < sizeof(blk::ListNode<int>));
+}
+
+BOOST_AUTO_TEST_CASE(insert_and_erase_after)
+{
+	blk::forward_list<int> list;
+	BOOST_CHECK(list.empty());
+	auto it = list.insert_after(list.before_begin(), 1);
+	it = list.insert_after(it, 2);
+	list.insert_after(it, { 3, 4, 5 });
+	list.push_front(0);
+	int expected = 0;
+	for (auto i : list)
+		BOOST_CHECK(i == expected++);
+	BOOST_CHECK(expected == 6);
+
+	BOOST_CHECK(*list.erase_after(list.begin()) == 2);
+	auto first = list.begin();
+	auto last = first;
+	std::advance(last, 3);
+	list.erase_after(first, last);
+	BOOST_CHECK(list == blk::forward_list<int>({ 0, 4, 5 }));
+	list.pop_front();
+	BOOST_CHECK(list.front() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(construct_copy_and_move)
+{
+	blk::forward_list<TestClass> l1;
+	auto it = l1.before_begin();
+	for (int i = 0; i < 5; i++)
+		it = l1.emplace_after(it, i);
+	blk::forward_list<TestClass> l2(l1);
+	blk::forward_list<TestClass> l3(std::move(l1));
+	auto it2 = l2.begin();
+	auto it3 = l3.begin();
+	for (int i = 0; i < 5; i++, ++it2, ++it3)
+	{
+		BOOST_CHECK(it2->getValue() == i);
+		BOOST_CHECK(it3->getValue() == i);
+	}
+	BOOST_CHECK(it2 == l2.end() && it3 == l3.end());
+
+	blk::forward_list<int> l4(3, 7);
+	BOOST_CHECK(l4 == blk::forward_list<int>({ 7, 7, 7 }));
+	l4.resize(1);
+	l4.resize(3, 1);
+	BOOST_CHECK(l4 == blk::forward_list<int>({ 7, 1, 1 }));
+}
+
+BOOST_AUTO_TEST_CASE(splice_after_ranges)
+{
+	blk::forward_list<int> l1 { 1, 2, 3 };
+	blk::forward_list<int> l2 { 10, 20, 30, 40 };
+	l1.splice_after(l1.begin(), l2, l2.begin(), std::next(l2.begin(), 3));
+	BOOST_CHECK(l1 == blk::forward_list<int>({ 1, 20, 30, 2, 3 }));
+	BOOST_CHECK(l2 == blk::forward_list<int>({ 10, 40 }));
+
+	l1.splice_after(l1.before_begin(), l2, l2.begin());
+	BOOST_CHECK(l1.front() == 40);
+	BOOST_CHECK(l2 == blk::forward_list<int>({ 10 }));
+
+	l1.splice_after(l1.before_begin(), l2);
+	BOOST_CHECK(l2.empty());
+	BOOST_CHECK(l1 == blk::forward_list<int>({ 10, 40, 1, 20, 30, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(splice_after_range_onto_itself_is_no_op)
+{
+	blk::forward_list<TestClass> list;
+	for (int i = 3; i >= 0; i--)
+		list.emplace_front(i);
+	list.splice_after(list.cbefore_begin(), list, list.cbefore_begin(), list.cend());
+	list.splice_after(list.cbegin(), list, list.cbegin(), std::next(list.cbegin(), 3));
+	// pos is the last node of the range (1, 3)
+	list.splice_after(std::next(list.cbegin(), 2), list, list.cbegin(), std::next(list.cbegin(), 3));
+	int expected = 0;
+	for (auto& v : list)
+		BOOST_CHECK(v.getValue() == expected++);
+	BOOST_CHECK(expected == 4);
+
+	list.splice_after(list.cbefore_begin(), list, std::next(list.cbegin(), 1), list.cend());
+	int expectedMoved[] = { 2, 3, 0, 1 };
+	int i = 0;
+	for (auto& v : list)
+		BOOST_CHECK(v.getValue() == expectedMoved[i++]);
+	BOOST_CHECK(i == 4);
+}
+
+BOOST_AUTO_TEST_CASE(splice_after_with_different_allocators)
+{
+	blk::forward_list<int, TestAllocator<int>> l1({ 1, 2 }, TestAllocator<int>(0));
+	blk::forward_list<int, TestAllocator<int>> l2({ 3, 4 }, TestAllocator<int>(1));
+	l1.splice_after(l1.begin(), l2);
+	BOOST_CHECK(l2.empty());
+	int expected[] = { 1, 3, 4, 2 };
+	int i = 0;
+	for (auto val : l1)
+		BOOST_CHECK(val == expected[i++]);
+	BOOST_CHECK(i == 4);
+}
+
+BOOST_AUTO_TEST_CASE(sort_merge_unique_reverse)
+{
+	blk::forward_list<int> l1;
+	for (int i = 0; i < 50; i++)
+		l1.push_front((i * 13) % 50);
+	l1.sort();
+	int expected = 0;
+	for (auto i : l1)
+		BOOST_CHECK(i == expected++);
+
+	blk::forward_list<int> l2 { 0, 10, 10, 60 };
+	l1.merge(l2);
+	BOOST_CHECK(l2.empty());
+	l1.unique();
+	expected = 0;
+	for (auto i : l1)
+		BOOST_CHECK(i == expected++ || (i == 60 && expected == 51));
+
+	l1.reverse();
+	BOOST_CHECK(l1.front() == 60);
+	l1.remove_if([](int i) { return i >= 10; });
+	BOOST_CHECK(l1 == blk::forward_list<int>({ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
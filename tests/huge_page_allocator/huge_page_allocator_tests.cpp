@@ -0,0 +1,92 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+#include "../../include/huge_page_allocator.h"
+#include "../../include/list.h"
+#include "../test_class.h"
+
+BOOST_AUTO_TEST_SUITE(huge_page_allocator)
+
+BOOST_AUTO_TEST_CASE(regions_are_aligned_and_slots_reused)
+{
+	blk::HugePageArena arena;
+	void* first = arena.allocate(24, 8);
+	void* second = arena.allocate(24, 8);
+	BOOST_CHECK(arena.regionCount() == 1);
+	BOOST_CHECK(arena.owns(first) && arena.owns(second));
+	BOOST_CHECK(reinterpret_cast<std::uintptr_t>(first) % blk::HugePageArena::hugePageSize == 0);
+	BOOST_CHECK(static_cast<char*>(second) - static_cast<char*>(first) == 24);
+	arena.deallocate(first, 24, 8);
+	BOOST_CHECK(arena.allocate(24, 8) == first);
+	// Another size class carves fresh memory
+	void* other = arena.allocate(40, 16);
+	BOOST_CHECK(reinterpret_cast<std::uintptr_t>(other) % 16 == 0 && other != first);
+	arena.deallocate(other, 40, 16);
+	arena.deallocate(second, 24, 8);
+
+	void* large = arena.allocate(blk::HugePageArena::maxSlotSize + 1, 8);
+	BOOST_CHECK(!arena.owns(large));
+	arena.deallocate(large, blk::HugePageArena::maxSlotSize + 1, 8);
+	BOOST_CHECK(arena.hugePageRegions() <= arena.regionCount());
+}
+
+BOOST_AUTO_TEST_CASE(list_fills_new_regions)
+{
+	auto arena = std::make_shared<blk::HugePageArena>();
+	blk::huge_page_allocator<TestClass> alloc(arena);
+	blk::list<TestClass, blk::huge_page_allocator<TestClass>> list(alloc);
+	const int count = static_cast<int>(arena->regionSize() / sizeof(blk::ListNode<TestClass>)) + 100;
+	for (int i = 0; i < count; ++i)
+		list.emplace_back(i);
+	BOOST_CHECK(arena->regionCount() == 2);
+	int expected = 0;
+	bool inArena = true;
+	for (auto it = list.begin(); it != list.end(); ++it, ++expected)
+	{
+		inArena = inArena && arena->owns(&*it);
+		BOOST_REQUIRE(it->getValue() == expected);
+	}
+	BOOST_CHECK(inArena);
+
+	// Lists sharing the arena relink nodes, others copy them
+	blk::list<TestClass, blk::huge_page_allocator<TestClass>> shared(alloc);
+	shared.splice(shared.end(), list, list.begin());
+	BOOST_CHECK(shared.front().getValue() == 0 && list.size() == static_cast<size_t>(count - 1));
+	blk::list<TestClass, blk::huge_page_allocator<TestClass>> separate;
+	BOOST_CHECK(separate.get_allocator() != alloc);
+	separate.splice(separate.end(), shared);
+	BOOST_CHECK(separate.size() == 1 && shared.empty());
+	BOOST_CHECK(!arena->owns(&separate.front()));
+}
+
+BOOST_AUTO_TEST_CASE(over_aligned_requests)
+{
+	struct alignas(128) Wide
+	{
+		int value;
+	};
+	auto arena = std::make_shared<blk::HugePageArena>();
+	blk::list<Wide, blk::huge_page_allocator<Wide>> list((blk::huge_page_allocator<Wide>(arena)));
+	for (int i = 0; i < 10; ++i)
+		list.push_back(Wide { i });
+	bool aligned = true;
+	for (auto it = list.begin(); it != list.end(); ++it)
+		aligned = aligned && reinterpret_cast<std::uintptr_t>(&*it) % 128 == 0 && arena->owns(&*it);
+	BOOST_CHECK(aligned && list.back().value == 9);
+
+	void* large = arena->allocate(blk::HugePageArena::maxSlotSize * 4, 256);
+	BOOST_CHECK(!arena->owns(large) && reinterpret_cast<std::uintptr_t>(large) % 256 == 0);
+	arena->deallocate(large, blk::HugePageArena::maxSlotSize * 4, 256);
+}
+
+BOOST_AUTO_TEST_CASE(allocation_size_overflow)
+{
+	blk::huge_page_allocator<std::uint64_t> alloc;
+	BOOST_CHECK_THROW(alloc.allocate(std::numeric_limits<size_t>::max() / 4), std::bad_array_new_length);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,220 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <iterator>
+#include <list>
+#include <random>
+#include "../../include/indexed_list.h"
+#include "../test_class.h"
+#include "../test_allocator.h"
+
+BOOST_AUTO_TEST_SUITE(indexed_list)
+
+BOOST_AUTO_TEST_CASE(nth_and_index_of)
+{
+	int num = 1000;
+	blk::indexed_list<int> list;
+	for (int i = 0; i < num; i++)
+		list.push_back(i);
+	BOOST_CHECK(list.size() == size_t(num));
+	for (int i = 0; i < num; i += 7)
+	{
+		auto it = list.nth(i);
+		BOOST_CHECK(*it == i);
+		BOOST_CHECK(list.index_of(it) == size_t(i));
+	}
+	BOOST_CHECK(list.nth(num) == list.end());
+	BOOST_CHECK(list.index_of(list.end()) == size_t(num));
+}
+
+BOOST_AUTO_TEST_CASE(random_access_iterators)
+{
+	blk::indexed_list<int> list;
+	for (int i = 0; i < 100; i++)
+		list.push_front(99 - i);
+	auto it = list.begin();
+	std::advance(it, 42);
+	BOOST_CHECK(*it == 42);
+	BOOST_CHECK(std::distance(list.begin(), it) == 42);
+	BOOST_CHECK(it[10] == 52);
+	BOOST_CHECK(*(it - 40) == 2);
+	BOOST_CHECK(list.end() - list.begin() == 100);
+	BOOST_CHECK(list.begin() < it && it < list.end());
+	BOOST_CHECK(*(list.rbegin() + 9) == 90);
+}
+
+BOOST_AUTO_TEST_CASE(insert_and_erase_keep_positions)
+{
+	blk::indexed_list<TestClass> list;
+	for (int i = 0; i < 10; i++)
+		list.emplace_back(i * 2);
+	for (int i = 0; i < 10; i++)
+		list.emplace(list.nth(2 * i + 1), i * 2 + 1);
+	BOOST_CHECK(list.size() == 20);
+	for (int i = 0; i < 20; i++)
+		BOOST_CHECK(list.nth(i)->getValue() == i);
+
+	auto it = list.erase(list.nth(5));
+	BOOST_CHECK(it->getValue() == 6);
+	BOOST_CHECK(list.index_of(it) == 5);
+	it = list.erase(list.nth(2), list.nth(8));
+	BOOST_CHECK(it->getValue() == 9);
+	BOOST_CHECK(list.size() == 13);
+	BOOST_CHECK(list.nth(2)->getValue() == 9);
+}
+
+BOOST_AUTO_TEST_CASE(splice_ranges)
+{
+	blk::indexed_list<int> l1 { 0, 1, 2, 3, 4 };
+	blk::indexed_list<int> l2 { 10, 11, 12, 13 };
+	l1.splice(l1.nth(2), l2, l2.nth(1), l2.nth(3));
+	int expected1[] = { 0, 1, 11, 12, 2, 3, 4 };
+	BOOST_CHECK(l1.size() == 7 && l2.size() == 2);
+	for (int i = 0; i < 7; i++)
+		BOOST_CHECK(*l1.nth(i) == expected1[i]);
+	BOOST_CHECK(*l2.nth(1) == 13);
+
+	l1.splice(l1.begin(), l2);
+	BOOST_CHECK(l2.empty() && l1.size() == 9);
+	BOOST_CHECK(*l1.nth(1) == 13 && *l1.nth(8) == 4);
+
+	l1.splice(l1.end(), l1, l1.begin());
+	BOOST_CHECK(l1.back() == 10 && l1.index_of(--l1.end()) == 8);
+}
+
+BOOST_AUTO_TEST_CASE(self_splice_onto_itself_is_no_op)
+{
+	blk::indexed_list<int> list { 0, 1, 2, 3, 4 };
+	list.splice(list.nth(2), list, list.nth(2));
+	list.splice(list.nth(3), list, list.nth(2));
+	list.splice(list.nth(1), list, list.nth(1), list.nth(3));
+	list.splice(list.nth(3), list, list.nth(1), list.nth(3));
+	BOOST_CHECK(list.size() == 5);
+	for (int i = 0; i < 5; i++)
+	{
+		BOOST_CHECK(*list.nth(i) == i);
+		BOOST_CHECK(list.index_of(list.nth(i)) == size_t(i));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(self_splice_matches_std_list)
+{
+	std::mt19937 rng(17);
+	blk::indexed_list<int> list;
+	std::list<int> reference;
+	for (int i = 0; i < 50; i++)
+	{
+		list.push_back(i);
+		reference.push_back(i);
+	}
+	for (int step = 0; step < 2000; step++)
+	{
+		size_t first = rng() % 51;
+		size_t last = first + rng() % (51 - first);
+		// pos must not lie strictly inside [first, last); std::list does not
+		// allow pos == first either, where the splice is a no-op
+		size_t pos = rng() % 51;
+		if (pos > first && pos < last)
+			pos = rng() % 2 ? first : last;
+		list.splice(list.nth(pos), list, list.nth(first), list.nth(last));
+		if (pos != first || first == last)
+			reference.splice(std::next(reference.begin(), pos), reference,
+				std::next(reference.begin(), first), std::next(reference.begin(), last));
+		BOOST_REQUIRE(list.size() == 50);
+	}
+	BOOST_CHECK(std::equal(list.begin(), list.end(), reference.begin()));
+	for (int i = 0; i < 50; i++)
+		BOOST_CHECK(list.index_of(list.nth(i)) == size_t(i));
+}
+
+BOOST_AUTO_TEST_CASE(splice_with_different_allocators)
+{
+	blk::indexed_list<int, TestAllocator<int>> l1({ 1, 2 }, TestAllocator<int>(0));
+	blk::indexed_list<int, TestAllocator<int>> l2({ 3, 4 }, TestAllocator<int>(1));
+	l1.splice(l1.end(), l2);
+	BOOST_CHECK(l1.size() == 4 && l2.empty());
+	BOOST_CHECK(*l1.nth(3) == 4);
+}
+
+BOOST_AUTO_TEST_CASE(reordering_operations)
+{
+	blk::indexed_list<int> list;
+	for (int i = 0; i < 200; i++)
+		list.push_back((i * 37) % 200);
+	list.sort();
+	for (int i = 0; i < 200; i++)
+		BOOST_CHECK(*list.nth(i) == i);
+
+	list.reverse();
+	BOOST_CHECK(*list.nth(0) == 199 && *list.nth(199) == 0);
+
+	list.remove_if([](int i) { return i % 2 == 0; });
+	BOOST_CHECK(list.size() == 100);
+	BOOST_CHECK(*list.nth(99) == 1);
+
+	blk::indexed_list<int> other { 0, 0, 2, 2, 4 };
+	other.unique();
+	BOOST_CHECK(other.size() == 3);
+	list.sort();
+	list.merge(other);
+	BOOST_CHECK(list.size() == 103);
+	BOOST_CHECK(*list.nth(0) == 0 && *list.nth(1) == 1 && *list.nth(2) == 2);
+	BOOST_CHECK(list.index_of(list.end()) == 103);
+}
+
+BOOST_AUTO_TEST_CASE(rebuilt_tree_keeps_positions_valid)
+{
+	std::mt19937 rng(23);
+	blk::indexed_list<int> list;
+	for (int i = 0; i < 5000; i++)
+		list.push_back(static_cast<int>(rng() % 2500));
+	list.sort();
+	blk::indexed_list<int> other { -2, -1, 2600 };
+	list.merge(other);
+	list.unique();
+	bool valid = true;
+	for (size_t i = 0; i < list.size(); i++)
+	{
+		auto it = list.nth(i);
+		valid = valid && list.index_of(it) == i && (i == 0 || *list.nth(i - 1) < *it);
+	}
+	BOOST_CHECK(valid);
+	BOOST_CHECK(list.front() == -2 && list.back() == 2600);
+}
+
+BOOST_AUTO_TEST_CASE(reverse_keeps_positions_valid)
+{
+	blk::indexed_list<int> list;
+	for (int i = 0; i < 300; i++)
+		list.push_back(i);
+	list.reverse();
+	for (int i = 0; i < 300; i++)
+	{
+		BOOST_REQUIRE(*list.nth(i) == 299 - i);
+		BOOST_REQUIRE(list.index_of(list.nth(i)) == size_t(i));
+	}
+
+	list.insert(list.nth(100), -1);
+	list.erase(list.nth(0));
+	list.reverse();
+	BOOST_CHECK(list.size() == 300);
+	BOOST_CHECK(*list.nth(0) == 0 && *list.nth(200) == -1 && *list.nth(299) == 298);
+	BOOST_CHECK(list.index_of(list.nth(200)) == 200);
+}
+
+BOOST_AUTO_TEST_CASE(copy_move_and_compare)
+{
+	blk::indexed_list<int> l1 { 1, 2, 3 };
+	blk::indexed_list<int> l2(l1);
+	BOOST_CHECK(l1 == l2);
+	blk::indexed_list<int> l3(std::move(l1));
+	BOOST_CHECK(l3 == l2);
+	l2.pop_back();
+	BOOST_CHECK(l2 < l3);
+	l2 = l3;
+	BOOST_CHECK(l2 == l3);
+	l2.resize(1);
+	BOOST_CHECK(l2.size() == 1 && l2.front() == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
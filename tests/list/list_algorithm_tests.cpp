@@ -0,0 +1,145 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../../include/list_algorithm.h"
+#include "../../include/small_list.h"
+#include "../test_class.h"
+
+BOOST_AUTO_TEST_SUITE(list_algorithm)
+
+BOOST_AUTO_TEST_CASE(merge_test)
+{
+	blk::list<int> l1 { 1, 3, 5, 7 };
+	blk::list<int> l2 { 0, 3, 4, 9 };
+	l1.merge(l2);
+	int expected[] = { 0, 1, 3, 3, 4, 5, 7, 9 };
+	BOOST_CHECK(l1.size() == 8 && l2.empty());
+	BOOST_CHECK(std::equal(l1.begin(), l1.end(), expected));
+	BOOST_CHECK(l1.back() == 9 && *--l1.end() == 9);
+
+	blk::list<int> empty;
+	empty.merge(blk::list<int> { 2, 1 }, std::greater<int>());
+	BOOST_CHECK(empty.size() == 2 && empty.front() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(merge_all_test)
+{
+	std::vector<blk::list<TestClass>> shards(5);
+	std::vector<const TestClass*> addresses;
+	for (int i = 0; i < 100; i++)
+	{
+		shards[(i * 7) % 5].emplace_back(i);
+		addresses.push_back(&shards[(i * 7) % 5].back());
+	}
+	blk::list<TestClass> merged;
+	merged.emplace_back(-1);
+	blk::merge_all(merged, shards, [](const TestClass& left, const TestClass& right) { return left.getValue() < right.getValue(); });
+	BOOST_CHECK(merged.size() == 101);
+	for (auto& shard : shards)
+		BOOST_CHECK(shard.empty());
+	int expected = -1;
+	auto it = merged.begin();
+	for (; it != merged.end(); ++it, ++expected)
+	{
+		BOOST_CHECK(it->getValue() == expected);
+		if (expected >= 0)
+			BOOST_CHECK(&*it == addresses[expected]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(merge_all_is_stable)
+{
+	std::vector<blk::small_list<std::pair<int, int>, 4>> shards(3);
+	for (int s = 0; s < 3; s++)
+		for (int i = 0; i < 6; i++)
+			shards[s].emplace_back(i / 2, s);
+	blk::small_list<std::pair<int, int>, 4> merged;
+	blk::merge_all(merged, shards, [](const std::pair<int, int>& left, const std::pair<int, int>& right) { return left.first < right.first; });
+	BOOST_CHECK(merged.size() == 18);
+	BOOST_CHECK(std::is_sorted(merged.begin(), merged.end()));
+}
+
+BOOST_AUTO_TEST_CASE(parallel_merge_all_test)
+{
+	std::vector<blk::list<std::pair<int, int>>> shards(16);
+	for (int s = 0; s < 16; s++)
+		for (int i = 0; i < 2000; i++)
+			shards[s].emplace_back((i * (s + 3)) % 5000, s);
+	for (auto& shard : shards)
+		shard.sort();
+	blk::list<std::pair<int, int>> merged { { -1, -1 } };
+	blk::merge_all(merged, shards, [](const std::pair<int, int>& left, const std::pair<int, int>& right) { return left.first < right.first; }, 4);
+	BOOST_CHECK(merged.size() == 32001);
+	BOOST_CHECK(merged.front().first == -1);
+	for (auto& shard : shards)
+		BOOST_CHECK(shard.empty());
+	BOOST_CHECK(std::is_sorted(merged.begin(), merged.end()));
+}
+
+BOOST_AUTO_TEST_CASE(parallel_merge_all_default_threads)
+{
+	std::vector<blk::list<int>> shards(8);
+	for (int s = 0; s < 8; s++)
+		for (int i = 0; i < 4000; i++)
+			shards[s].push_back(i * 8 + s);
+	blk::list<int> merged;
+	blk::merge_all(merged, shards, [](int left, int right) { return left < right; }, 0);
+	BOOST_CHECK(merged.size() == 32000);
+	int expected = 0;
+	bool ordered = true;
+	for (int v : merged)
+		ordered = ordered && v == expected++;
+	BOOST_CHECK(ordered);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for_each_test)
+{
+	blk::list<int> l;
+	for (int i = 0; i < 10000; i++)
+		l.push_back(i);
+	blk::parallel_for_each(l, [](int& v) { v *= 2; }, 4);
+	int expected = 0;
+	for (int v : l)
+	{
+		BOOST_CHECK(v == expected);
+		expected += 2;
+	}
+
+	blk::list<int> empty;
+	blk::parallel_for_each(empty, [](int& v) { v = 1; });
+	BOOST_CHECK(empty.empty());
+}
+
+BOOST_AUTO_TEST_CASE(parallel_transform_reduce_test)
+{
+	blk::list<int> l;
+	for (int i = 1; i <= 1000; i++)
+		l.push_back(i);
+	auto square = [](int v) { return static_cast<long long>(v) * v; };
+	auto plus = [](long long left, long long right) { return left + right; };
+	BOOST_CHECK(blk::parallel_transform_reduce(l, 0LL, plus, square, 3) == 333833500LL);
+	BOOST_CHECK(blk::parallel_transform_reduce(blk::list<int>(), 7LL, plus, square) == 7);
+
+	// Concatenation is associative but not commutative, so this checks the
+	// chunk order
+	auto concat = [](std::string left, std::string right) { return left + right; };
+	auto digit = [](int v) { return std::to_string(v % 10); };
+	std::string serial;
+	for (int v : l)
+		serial += digit(v);
+	for (size_t threads : { 1, 2, 5, 16 })
+		BOOST_CHECK(blk::parallel_transform_reduce(l, std::string(">"), concat, digit, threads) == ">" + serial);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_exception_test)
+{
+	blk::list<int> l;
+	for (int i = 0; i < 100; i++)
+		l.push_back(i);
+	BOOST_CHECK_THROW(blk::parallel_for_each(l, [](int v) { if (v == 50) throw std::runtime_error("fail"); }, 4), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../../include/list_io.h"
+#include "../../include/small_list.h"
+
+namespace
+{
+struct Sample
+{
+	int id;
+	double weight;
+	char tag;
+};
+
+void writeString(std::ostream& out, const std::string& value)
+{
+	std::uint32_t size = static_cast<std::uint32_t>(value.size());
+	out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+	out.write(value.data(), size);
+}
+
+std::string readString(std::istream& in)
+{
+	std::uint32_t size = 0;
+	in.read(reinterpret_cast<char*>(&size), sizeof(size));
+	std::string value(size, '\0');
+	in.read(&value[0], size);
+	return value;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(list_io)
+
+BOOST_AUTO_TEST_CASE(round_trip_spans_several_chunks)
+{
+	blk::list<int> source;
+	const int count = static_cast<int>(blk::listChunkElements<int>() * 2 + 17);
+	for (int i = 0; i < count; ++i)
+		source.push_back(i * 3 - 7);
+	std::stringstream stream;
+	blk::save(source, stream);
+	BOOST_CHECK(stream.str().size() == sizeof(blk::ListStreamHeader) + 4 * sizeof(std::uint32_t) + count * sizeof(int));
+
+	blk::list<int> loaded { 1, 2, 3 };
+	blk::load(loaded, stream);
+	BOOST_CHECK(loaded == source);
+}
+
+BOOST_AUTO_TEST_CASE(structs_and_other_lists)
+{
+	blk::small_list<Sample, 4> source;
+	source.push_back(Sample { 1, 0.5, 'a' });
+	source.push_back(Sample { 2, 1.5, 'b' });
+	std::stringstream stream;
+	blk::save(source, stream);
+	blk::list<Sample> loaded;
+	blk::load(loaded, stream);
+	BOOST_REQUIRE(loaded.size() == 2);
+	BOOST_CHECK(loaded.front().id == 1 && loaded.front().weight == 0.5 && loaded.front().tag == 'a');
+	BOOST_CHECK(loaded.back().id == 2 && loaded.back().weight == 1.5 && loaded.back().tag == 'b');
+
+	blk::list<int> empty;
+	std::stringstream emptyStream;
+	blk::save(empty, emptyStream);
+	blk::list<int> target { 4 };
+	blk::load(target, emptyStream);
+	BOOST_CHECK(target.empty());
+}
+
+BOOST_AUTO_TEST_CASE(custom_element_encoding)
+{
+	blk::list<std::string> source { "", "one", std::string(1000, 'x') };
+	std::stringstream stream;
+	blk::save(source, stream, writeString);
+	blk::list<std::string> loaded;
+	blk::load(loaded, stream, readString);
+	BOOST_CHECK(loaded == source);
+
+	// Raw and encoded streams are not interchangeable
+	std::stringstream again(stream.str());
+	blk::list<int> ints;
+	BOOST_CHECK_THROW(blk::load(ints, again), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(rejects_malformed_input)
+{
+	blk::list<int> source { 1, 2, 3, 4 };
+	std::stringstream stream;
+	blk::save(source, stream);
+	const std::string image = stream.str();
+
+	blk::list<int> loaded { 9 };
+	std::stringstream truncated(image.substr(0, image.size() - 6));
+	BOOST_CHECK_THROW(blk::load(loaded, truncated), std::runtime_error);
+	BOOST_CHECK(loaded.empty());
+
+	std::string badMagic = image;
+	badMagic[0] = 'X';
+	std::stringstream badMagicStream(badMagic);
+	loaded.push_back(9);
+	BOOST_CHECK_THROW(blk::load(loaded, badMagicStream), std::runtime_error);
+	BOOST_CHECK(loaded.empty());
+
+	std::stringstream wrongType(image);
+	blk::list<double> doubles { 1.5 };
+	BOOST_CHECK_THROW(blk::load(doubles, wrongType), std::runtime_error);
+	BOOST_CHECK(doubles.empty());
+
+	std::stringstream empty;
+	BOOST_CHECK_THROW(blk::load(loaded, empty), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
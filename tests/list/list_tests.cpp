@@ -1,8 +1,11 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <stdexcept>
+#include <string>
 #include "../../include/list.h"
 #include "../test_class.h"
+#include "../test_allocator.h"
 
 BOOST_AUTO_TEST_SUITE(list)
 
@@ -94,4 +97,360 @@ BOOST_AUTO_TEST_CASE(remove_predicate_test)
 	BOOST_CHECK(*list.begin() == 3 && *list.rbegin() == 2);
 }
 
+BOOST_AUTO_TEST_CASE(erase_updates_size_test)
+{
+	blk::list<int> list { 1, 2, 3 };
+	list.erase(list.begin());
+	list.pop_back();
+	BOOST_CHECK(list.size() == 1);
+	BOOST_CHECK(*list.begin() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(for_each_prefetched_test)
+{
+	int num = 100;
+	blk::list<int> list;
+	for (int i = 0; i < num; i++)
+		list.push_back(i);
+
+	for (size_t distance : { 0, 1, 4, 1000 })
+	{
+		int cnt = 0;
+		int sum = 0;
+		list.for_each_prefetched([&](int i) { cnt++; sum += i; }, distance);
+		BOOST_CHECK(cnt == num);
+		BOOST_CHECK(sum == (num * (num - 1)) / 2);
+	}
+
+	list.for_each_prefetched([](int& i) { i *= 2; });
+	int expected = 0;
+	for (auto i : list)
+	{
+		BOOST_CHECK(i == expected);
+		expected += 2;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(prefetched_traversals_test)
+{
+	int num = 50;
+	blk::list<int> list;
+	for (int i = 0; i < num; i++)
+		list.push_back((i * 7) % num);
+	list.sort();
+	int expected = 0;
+	for (auto i : list)
+		BOOST_CHECK(i == expected++);
+
+	list.reverse();
+	BOOST_CHECK(*list.begin() == num - 1);
+	BOOST_CHECK(*list.rbegin() == 0);
+
+	blk::list<int> copy(list);
+	BOOST_CHECK(copy == list);
+	BOOST_CHECK(!(copy < list));
+	copy.pop_back();
+	BOOST_CHECK(copy < list);
+
+	list.remove_if([](int i) { return i % 2 == 0; });
+	BOOST_CHECK(list.size() == static_cast<size_t>(num / 2));
+	for (auto i : list)
+		BOOST_CHECK(i % 2 == 1);
+}
+
+BOOST_AUTO_TEST_CASE(extract_and_insert_node_test)
+{
+	blk::list<TestClass> l1;
+	blk::list<TestClass> l2;
+	for (int i = 0; i < 3; i++)
+		l1.emplace_back(i);
+	auto node = l1.extract(++l1.begin());
+	BOOST_CHECK(!node.empty());
+	BOOST_CHECK(node.value().getValue() == 1);
+	BOOST_CHECK(l1.size() == 2);
+
+	TestClass* address = &node.value();
+	auto it = l2.insert(l2.end(), std::move(node));
+	BOOST_CHECK(node.empty());
+	BOOST_CHECK(&*it == address);
+	BOOST_CHECK(l2.size() == 1 && l2.begin()->getValue() == 1);
+
+	BOOST_CHECK(l2.insert(l2.end(), blk::list<TestClass>::node_type()) == l2.end());
+	BOOST_CHECK(l2.size() == 1);
+
+	auto dropped = l1.extract(l1.begin());
+	BOOST_CHECK(l1.size() == 1 && l1.begin()->getValue() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(insert_node_with_different_allocator_test)
+{
+	blk::list<int, TestAllocator<int>> l1({ 1, 2 }, TestAllocator<int>(0));
+	blk::list<int, TestAllocator<int>> l2(TestAllocator<int>(1));
+	auto node = l1.extract(l1.begin());
+	l2.insert(l2.end(), std::move(node));
+	BOOST_CHECK(node.empty());
+	BOOST_CHECK(l2.size() == 1 && *l2.begin() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(splice_node_onto_itself_test)
+{
+	blk::list<int> l { 1, 2, 3 };
+	l.splice(l.begin(), l, l.begin());
+	l.splice(std::next(l.begin()), l, l.begin());
+	l.splice(l.begin(), l, std::next(l.begin(), 2));
+	int expected[] = { 3, 1, 2 };
+	BOOST_CHECK(l.size() == 3);
+	BOOST_CHECK(std::equal(l.begin(), l.end(), expected));
+}
+
+BOOST_AUTO_TEST_CASE(reuse_after_clear_test)
+{
+	blk::list<int> l { 1, 2, 3 };
+	l.clear();
+	BOOST_CHECK(l.empty() && l.begin() == l.end());
+	l.push_back(4);
+	BOOST_CHECK(l.size() == 1 && l.front() == 4 && l.back() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(unique_test)
+{
+	blk::list<int> l1 { 1, 1 };
+	l1.unique();
+	BOOST_CHECK(l1.size() == 1 && l1.front() == 1);
+
+	blk::list<int> l2 { 1, 1, 2, 3, 3, 3, 1, 4, 4 };
+	l2.unique();
+	int expected[] = { 1, 2, 3, 1, 4 };
+	BOOST_CHECK(l2.size() == 5);
+	BOOST_CHECK(std::equal(l2.begin(), l2.end(), expected));
+	BOOST_CHECK(l2.back() == 4 && *--l2.end() == 4);
+
+	blk::list<int> l3 { 1, 2, 4, 5, 7, 8, 9 };
+	l3.unique([](int left, int right) { return right - left == 1; });
+	int expectedPred[] = { 1, 4, 7, 9 };
+	BOOST_CHECK(l3.size() == 4);
+	BOOST_CHECK(std::equal(l3.begin(), l3.end(), expectedPred));
+
+	blk::list<int> empty;
+	empty.unique();
+	BOOST_CHECK(empty.empty());
+}
+
+BOOST_AUTO_TEST_CASE(unique_all_test)
+{
+	blk::list<int> l { 3, 1, 3, 2, 1, 3, 4 };
+	l.unique_all();
+	int expected[] = { 3, 1, 2, 4 };
+	BOOST_CHECK(l.size() == 4);
+	BOOST_CHECK(std::equal(l.begin(), l.end(), expected));
+
+	blk::list<int> mod { 1, 2, 11, 3, 12, 22 };
+	mod.unique_all([](int v) { return std::hash<int>()(v % 10); }, [](int left, int right) { return left % 10 == right % 10; });
+	int expectedMod[] = { 1, 2, 3 };
+	BOOST_CHECK(mod.size() == 3);
+	BOOST_CHECK(std::equal(mod.begin(), mod.end(), expectedMod));
+}
+
+BOOST_AUTO_TEST_CASE(remove_and_erase_range_test)
+{
+	blk::list<int> l { 1, 2, 3, 2, 4, 2 };
+	l.remove(*std::next(l.begin()));
+	int expected[] = { 1, 3, 4 };
+	BOOST_CHECK(l.size() == 3);
+	BOOST_CHECK(std::equal(l.begin(), l.end(), expected));
+	BOOST_CHECK(l.back() == 4);
+
+	blk::list<int> range { 0, 1, 2, 3, 4, 5 };
+	auto it = range.erase(std::next(range.begin()), std::next(range.begin(), 4));
+	BOOST_CHECK(*it == 4);
+	BOOST_CHECK(range.size() == 3);
+	int expectedRange[] = { 0, 4, 5 };
+	BOOST_CHECK(std::equal(range.begin(), range.end(), expectedRange));
+	BOOST_CHECK(range.erase(it, it) == it);
+	BOOST_CHECK(range.size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(remove_if_into_list_test)
+{
+	blk::list<TestClass> l;
+	for (int i = 0; i < 6; i++)
+		l.emplace_back(i);
+	blk::list<TestClass> removed;
+	removed.emplace_back(-1);
+	TestClass *address = &*std::next(l.begin());
+	l.remove_if([](const TestClass& v) { return v.getValue() % 2 == 1; }, removed);
+	BOOST_CHECK(l.size() == 3 && removed.size() == 4);
+	BOOST_CHECK(&*std::next(removed.begin()) == address);
+	int expected[] = { -1, 1, 3, 5 };
+	int i = 0;
+	for (auto& v : removed)
+		BOOST_CHECK(v.getValue() == expected[i++]);
+	BOOST_CHECK((--removed.end())->getValue() == 5);
+
+	blk::list<int, TestAllocator<int>> l1({ 1, 2, 3 }, TestAllocator<int>(0));
+	blk::list<int, TestAllocator<int>> l2(TestAllocator<int>(1));
+	l1.remove_if([](int v) { return v != 2; }, l2);
+	BOOST_CHECK(l1.size() == 1 && l1.front() == 2);
+	BOOST_CHECK(l2.size() == 2 && l2.front() == 1 && l2.back() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(remove_if_into_list_throwing_predicate_test)
+{
+	blk::list<int> l { 1, 2, 3, 4, 5 };
+	blk::list<int> removed { 0 };
+	int calls = 0;
+	BOOST_CHECK_THROW(l.remove_if([&calls](int) -> bool
+	{
+		if (++calls == 3)
+			throw std::runtime_error("predicate");
+		return true;
+	}, removed), std::runtime_error);
+	// Elements matched before the throw stay moved, both lists remain valid
+	BOOST_CHECK(l.size() == 3 && removed.size() == 3);
+	int expectedList[] = { 3, 4, 5 };
+	int expectedRemoved[] = { 0, 1, 2 };
+	BOOST_CHECK(std::equal(l.begin(), l.end(), expectedList));
+	BOOST_CHECK(std::equal(removed.begin(), removed.end(), expectedRemoved));
+	BOOST_CHECK(*removed.rbegin() == 2 && *(--removed.end()) == 2);
+	removed.push_back(6);
+	BOOST_CHECK(removed.back() == 6 && removed.size() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(sort_by_key_test)
+{
+	blk::list<long long> signedKeys { 5, -3, 1LL << 40, 0, -(1LL << 40), 7, -3 };
+	signedKeys.sort_by_key([](long long v) { return v; });
+	long long expectedSigned[] = { -(1LL << 40), -3, -3, 0, 5, 7, 1LL << 40 };
+	BOOST_CHECK(std::equal(signedKeys.begin(), signedKeys.end(), expectedSigned));
+	BOOST_CHECK(signedKeys.back() == 1LL << 40 && *--signedKeys.end() == 1LL << 40);
+
+	blk::list<std::pair<unsigned, int>> pairs;
+	for (int i = 0; i < 1000; i++)
+		pairs.emplace_back((i * 7919u) % 13, i);
+	pairs.sort_by_key([](const std::pair<unsigned, int>& p) { return p.first; });
+	BOOST_CHECK(pairs.size() == 1000);
+	for (auto it = pairs.begin(), next = std::next(it); next != pairs.end(); ++it, ++next)
+		BOOST_CHECK(it->first < next->first || (it->first == next->first && it->second < next->second));
+
+	blk::list<TestClass> values;
+	for (int i : { 3, 1, 2 })
+		values.emplace_back(i);
+	TestClass *address = &values.front();
+	values.sort_by_key([](const TestClass& v) { return std::to_string(v.getValue()); });
+	BOOST_CHECK(values.front().getValue() == 1 && values.back().getValue() == 3);
+	BOOST_CHECK(&values.back() == address);
+}
+
+BOOST_AUTO_TEST_CASE(partition_test)
+{
+	blk::list<TestClass> l;
+	for (int i = 0; i < 8; i++)
+		l.emplace_back(i);
+	TestClass *address = &l.front();
+	auto split = l.stable_partition([](const TestClass& v) { return v.getValue() % 2 == 1; });
+	int expected[] = { 1, 3, 5, 7, 0, 2, 4, 6 };
+	int i = 0;
+	for (auto& v : l)
+		BOOST_CHECK(v.getValue() == expected[i++]);
+	BOOST_CHECK(l.size() == 8);
+	BOOST_CHECK(&*split == address);
+	BOOST_CHECK((--l.end())->getValue() == 6);
+
+	blk::list<int> all { 1, 2, 3 };
+	BOOST_CHECK(all.partition([](int) { return true; }) == all.end());
+	BOOST_CHECK(all.partition([](int) { return false; }) == all.begin());
+}
+
+BOOST_AUTO_TEST_CASE(set_operations_test)
+{
+	blk::list<int> l1 { 1, 2, 2, 4, 6 };
+	blk::list<int> l2 { 0, 2, 3, 4, 4, 7, 8 };
+	l1.set_union(l2);
+	int expectedUnion[] = { 0, 1, 2, 2, 3, 4, 4, 6, 7, 8 };
+	BOOST_CHECK(l1.size() == 10);
+	BOOST_CHECK(std::equal(l1.begin(), l1.end(), expectedUnion));
+	BOOST_CHECK(l2.size() == 2 && l2.front() == 2 && l2.back() == 4);
+
+	blk::list<int> l3 { 1, 2, 2, 3, 5, 5, 9 };
+	l3.set_intersection(blk::list<int> { 2, 3, 4, 5, 9, 10 });
+	int expectedIntersection[] = { 2, 3, 5, 9 };
+	BOOST_CHECK(l3.size() == 4);
+	BOOST_CHECK(std::equal(l3.begin(), l3.end(), expectedIntersection));
+	BOOST_CHECK(l3.back() == 9);
+
+	blk::list<int> l4 { 1, 2, 2, 3, 5, 5, 9 };
+	l4.set_difference(blk::list<int> { 2, 5, 6, 9 });
+	int expectedDifference[] = { 1, 2, 3, 5 };
+	BOOST_CHECK(l4.size() == 4);
+	BOOST_CHECK(std::equal(l4.begin(), l4.end(), expectedDifference));
+	BOOST_CHECK(l4.back() == 5);
+
+	blk::list<int, TestAllocator<int>> l5({ 5, 3, 1 }, TestAllocator<int>(0));
+	blk::list<int, TestAllocator<int>> l6({ 6, 5, 4 }, TestAllocator<int>(1));
+	l5.set_union(l6, std::greater<int>());
+	int expectedDescending[] = { 6, 5, 4, 3, 1 };
+	BOOST_CHECK(l5.size() == 5);
+	BOOST_CHECK(std::equal(l5.begin(), l5.end(), expectedDescending));
+	BOOST_CHECK(l6.size() == 1 && l6.front() == 5);
+}
+
+BOOST_AUTO_TEST_CASE(split_test)
+{
+	blk::list<int> l { 0, 1, 2, 3, 4, 5 };
+	auto tail = l.split(std::next(l.begin(), 4), 2);
+	BOOST_CHECK(l.size() == 4 && l.back() == 3);
+	BOOST_CHECK(tail.size() == 2 && tail.front() == 4 && tail.back() == 5);
+	auto rest = l.split(std::next(l.begin()));
+	BOOST_CHECK(l.size() == 1 && l.front() == 0);
+	BOOST_CHECK(rest.size() == 3 && rest.front() == 1 && rest.back() == 3);
+	auto none = l.split(l.end());
+	BOOST_CHECK(none.empty() && l.size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(split_into_test)
+{
+	blk::list<int> l;
+	for (int i = 0; i < 10; i++)
+		l.push_back(i);
+	auto parts = l.split_into(4);
+	BOOST_CHECK(l.empty());
+	BOOST_CHECK(parts.size() == 4);
+	size_t sizes[] = { 3, 3, 2, 2 };
+	int expected = 0;
+	for (size_t p = 0; p < parts.size(); p++)
+	{
+		BOOST_CHECK(parts[p].size() == sizes[p]);
+		for (int v : parts[p])
+			BOOST_CHECK(v == expected++);
+	}
+	BOOST_CHECK(expected == 10);
+	BOOST_CHECK(parts[3].back() == 9);
+
+	blk::list<int> small { 1 };
+	auto many = small.split_into(3);
+	BOOST_CHECK(many.size() == 3 && many[0].size() == 1 && many[1].empty() && many[2].empty());
+	BOOST_CHECK(small.split_into(0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(reverse_iterator_and_view_test)
+{
+	blk::list<int> l { 1, 2, 3 };
+	auto rit = l.rbegin();
+	BOOST_CHECK(*rit == 3 && *++rit == 2);
+	BOOST_CHECK(*rit.base() == 3);
+	BOOST_CHECK(blk::list<int>::reverse_iterator(l.end()) == l.rbegin());
+	blk::list<int>::const_reverse_iterator crit = rit;
+	BOOST_CHECK(crit == rit);
+
+	int expected[] = { 3, 2, 1 };
+	int i = 0;
+	for (int& v : l.reversed())
+		BOOST_CHECK(v == expected[i++]);
+	BOOST_CHECK(i == 3);
+	const blk::list<int>& cl = l;
+	BOOST_CHECK(cl.reversed().front() == 3 && cl.reversed().back() == 1 && cl.reversed().size() == 3);
+	l.reversed().front() = 4;
+	BOOST_CHECK(l.back() == 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,77 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+#include "../../include/list_view.h"
+#include "../test_allocator.h"
+
+BOOST_AUTO_TEST_SUITE(list_view)
+
+BOOST_AUTO_TEST_CASE(filter_transform_take_while)
+{
+	blk::list<int> source { 1, 2, 3, 4, 5, 6, 7, 8 };
+	auto even = blk::filter(source, [](int v) { return v % 2 == 0; });
+	auto squares = blk::transform(even, [](int v) { return v * v; });
+	BOOST_CHECK((std::vector<int>(squares.begin(), squares.end()) == std::vector<int> { 4, 16, 36, 64 }));
+	auto small = blk::take_while(squares, [](int v) { return v < 30; });
+	BOOST_CHECK((std::vector<int>(small.begin(), small.end()) == std::vector<int> { 4, 16 }));
+
+	// Views refer to lvalue lists, so later changes show through
+	source.push_back(10);
+	BOOST_CHECK((std::vector<int>(squares.begin(), squares.end()) == std::vector<int> { 4, 16, 36, 64, 100 }));
+
+	// Filtered elements can be modified in place
+	for (int& v : blk::filter(source, [](int v) { return v > 6; }))
+		v = 0;
+	BOOST_CHECK(source == blk::list<int>({ 1, 2, 3, 4, 5, 6, 0, 0, 0 }));
+
+	auto none = blk::filter(source, [](int) { return false; });
+	BOOST_CHECK(none.begin() == none.end());
+	auto all = blk::take_while(source, [](int) { return true; });
+	BOOST_CHECK(std::distance(all.begin(), all.end()) == 9);
+}
+
+BOOST_AUTO_TEST_CASE(chunk_and_zip)
+{
+	const blk::list<int> source { 1, 2, 3, 4, 5, 6, 7 };
+	std::vector<std::vector<int>> chunks;
+	for (auto part : blk::chunk(source, 3))
+		chunks.emplace_back(part.begin(), part.end());
+	BOOST_CHECK((chunks == std::vector<std::vector<int>> { { 1, 2, 3 }, { 4, 5, 6 }, { 7 } }));
+	auto empty = blk::chunk(source, 0);
+	BOOST_CHECK(empty.begin() == empty.end());
+
+	blk::list<std::string> names { "a", "b", "c" };
+	std::vector<std::string> joined;
+	for (auto pair : blk::zip(names, source))
+		joined.push_back(pair.first + std::to_string(pair.second));
+	BOOST_CHECK((joined == std::vector<std::string> { "a1", "b2", "c3" }));
+	for (auto pair : blk::zip(names, blk::transform(source, [](int v) { return v * 10; })))
+		pair.first += std::to_string(pair.second);
+	BOOST_CHECK(names == blk::list<std::string>({ "a10", "b20", "c30" }));
+}
+
+BOOST_AUTO_TEST_CASE(to_list_builds_once)
+{
+	blk::list<int> source { 5, 1, 4, 2, 3 };
+	auto result = blk::to_list(blk::transform(blk::filter(source, [](int v) { return v > 1; }), [](int v) { return std::to_string(v); }));
+	BOOST_CHECK(result == blk::list<std::string>({ "5", "4", "2", "3" }));
+
+	TestAllocator<int> alloc(7);
+	auto sums = blk::to_list(blk::transform(blk::chunk(source, 2), [](const blk::ListSubrange<blk::list<int>::iterator>& part)
+	{
+		int sum = 0;
+		for (int v : part)
+			sum += v;
+		return sum;
+	}), alloc);
+	BOOST_CHECK(sums.get_allocator().getValue() == 7);
+	BOOST_CHECK((std::vector<int>(sums.begin(), sums.end()) == std::vector<int> { 6, 6, 3 }));
+
+	// An rvalue list is moved into the view that reads it
+	auto owned = blk::filter(blk::list<int> { 1, 2, 3 }, [](int v) { return v != 2; });
+	BOOST_CHECK(blk::to_list(owned) == blk::list<int>({ 1, 3 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+#include "../../include/lru_cache.h"
+
+BOOST_AUTO_TEST_SUITE(lru_cache)
+
+BOOST_AUTO_TEST_CASE(put_and_get)
+{
+	blk::lru_cache<int, std::string> cache(4);
+	BOOST_CHECK(cache.empty());
+	cache.put(1, "one");
+	cache.put(2, "two");
+	BOOST_CHECK(cache.size() == 2);
+	BOOST_CHECK(*cache.get(1) == "one");
+	BOOST_CHECK(cache.get(3) == nullptr);
+	cache.put(2, "deux");
+	BOOST_CHECK(cache.size() == 2);
+	BOOST_CHECK(*cache.get(2) == "deux");
+	BOOST_CHECK(cache.contains(1) && !cache.contains(3));
+}
+
+BOOST_AUTO_TEST_CASE(least_recently_used_is_evicted)
+{
+	blk::lru_cache<int, int> cache(3);
+	for (int i = 0; i < 3; i++)
+		cache.put(i, i * 10);
+	BOOST_CHECK(cache.get(0) != nullptr);
+	cache.put(3, 30);
+	BOOST_CHECK(cache.size() == 3);
+	BOOST_CHECK(!cache.contains(1));
+	int expected[] = { 3, 0, 2 };
+	int i = 0;
+	for (auto& entry : cache)
+	{
+		BOOST_CHECK(entry.key == expected[i++]);
+		BOOST_CHECK(entry.value == entry.key * 10);
+	}
+	BOOST_CHECK(i == 3);
+}
+
+BOOST_AUTO_TEST_CASE(find_does_not_touch)
+{
+	blk::lru_cache<int, int> cache(2);
+	cache.put(1, 1);
+	cache.put(2, 2);
+	BOOST_CHECK(cache.find(1) != cache.end());
+	BOOST_CHECK(cache.find(5) == cache.end());
+	cache.put(3, 3);
+	BOOST_CHECK(!cache.contains(1));
+	cache.touch(cache.find(2));
+	cache.touch(cache.find(2));
+	cache.put(4, 4);
+	BOOST_CHECK(cache.contains(2) && !cache.contains(3));
+}
+
+BOOST_AUTO_TEST_CASE(emplace_keeps_existing_value)
+{
+	blk::lru_cache<int, std::string> cache(2);
+	BOOST_CHECK(cache.emplace(1, 3, 'a').second);
+	auto res = cache.emplace(1, "b");
+	BOOST_CHECK(!res.second);
+	BOOST_CHECK(res.first->value == "aaa");
+}
+
+BOOST_AUTO_TEST_CASE(evict_to_callback)
+{
+	blk::lru_cache<int, int> cache(100);
+	for (int i = 0; i < 10; i++)
+		cache.put(i, i);
+	std::vector<int> evicted;
+	BOOST_CHECK(cache.evict(4, [&](blk::LruCacheEntry<int, int>& entry) { evicted.push_back(entry.key); }) == 4);
+	BOOST_CHECK((evicted == std::vector<int> { 0, 1, 2, 3 }));
+	BOOST_CHECK(cache.size() == 6);
+	for (int i = 0; i < 4; i++)
+		BOOST_CHECK(!cache.contains(i));
+	BOOST_CHECK(cache.evict(100) == 6);
+	BOOST_CHECK(cache.empty());
+	cache.put(1, 1);
+	BOOST_CHECK(*cache.get(1) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(erase_and_clear)
+{
+	blk::lru_cache<int, int> cache(8);
+	for (int i = 0; i < 8; i++)
+		cache.put(i, i);
+	BOOST_CHECK(cache.erase(3) == 1);
+	BOOST_CHECK(cache.erase(3) == 0);
+	BOOST_CHECK(cache.size() == 7 && !cache.contains(3));
+	cache.clear();
+	BOOST_CHECK(cache.empty() && !cache.contains(0));
+	cache.put(0, 1);
+	BOOST_CHECK(*cache.get(0) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(rehash_keeps_entries)
+{
+	blk::lru_cache<int, int> cache(1000);
+	for (int i = 0; i < 2000; i++)
+		cache.put(i, -i);
+	BOOST_CHECK(cache.size() == 1000);
+	for (int i = 0; i < 1000; i++)
+		BOOST_CHECK(!cache.contains(i));
+	for (int i = 1000; i < 2000; i++)
+		BOOST_CHECK(*cache.get(i) == -i);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
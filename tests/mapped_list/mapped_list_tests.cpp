@@ -0,0 +1,114 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#if !defined(_WIN32)
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../../include/mapped_list.h"
+
+namespace
+{
+struct Point
+{
+	int x;
+	double y;
+};
+
+// Removes the backing file when a test finishes
+struct TempFile
+{
+	TempFile() : path("/tmp/blk_mapped_list_" + std::to_string(::getpid()) + ".bin")
+	{
+		std::remove(path.c_str());
+	}
+	~TempFile()
+	{
+		std::remove(path.c_str());
+	}
+	std::string path;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(mapped_list)
+
+BOOST_AUTO_TEST_CASE(modifiers)
+{
+	TempFile file;
+	blk::mapped_list<int> list(file.path);
+	BOOST_CHECK(list.empty() && list.begin() == list.end());
+	list.push_back(2);
+	list.push_back(3);
+	list.push_front(1);
+	list.insert(std::next(list.cbegin()), 10);
+	BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int> { 1, 10, 2, 3 }));
+	BOOST_CHECK(list.front() == 1 && list.back() == 3 && list.size() == 4);
+	auto it = list.erase(std::next(list.cbegin()));
+	BOOST_CHECK(*it == 2);
+	list.pop_front();
+	list.pop_back();
+	BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int> { 2 }));
+	BOOST_CHECK((std::vector<int>(list.cbegin(), list.cend()) == std::vector<int>(std::make_reverse_iterator(list.end()), std::make_reverse_iterator(list.begin()))));
+	list.clear();
+	BOOST_CHECK(list.empty() && list.size() == 0 && list.begin() == list.end());
+}
+
+BOOST_AUTO_TEST_CASE(free_nodes_are_reused)
+{
+	TempFile file;
+	blk::mapped_list<int> list(file.path, 4);
+	for (int i = 0; i < 4; ++i)
+		list.push_back(i);
+	size_t capacity = list.capacity();
+	int* first = &list.front();
+	list.pop_front();
+	list.push_back(4);
+	BOOST_CHECK(list.capacity() == capacity);
+	BOOST_CHECK(&list.back() == first);
+}
+
+BOOST_AUTO_TEST_CASE(grows_and_reopens)
+{
+	TempFile file;
+	{
+		blk::mapped_list<Point> list(file.path, 2);
+		for (int i = 0; i < 1000; ++i)
+			list.push_back(Point { i, i * 0.5 });
+		// The value refers into the mapping while it is being remapped
+		list.push_back(list.front());
+		list.erase(std::next(list.cbegin()));
+		BOOST_CHECK(list.capacity() >= list.size());
+		list.checkpoint();
+	}
+	blk::mapped_list<Point> list(file.path);
+	BOOST_REQUIRE(list.size() == 1000);
+	auto it = list.begin();
+	BOOST_CHECK(it->x == 0);
+	++it;
+	for (int i = 2; i < 1000; ++i, ++it)
+		BOOST_CHECK(it->x == i && it->y == i * 0.5);
+	BOOST_CHECK(it->x == 0);
+	list.push_front(Point { -1, 0 });
+	list.checkpoint(true);
+	BOOST_CHECK(list.front().x == -1 && list.size() == 1001);
+}
+
+BOOST_AUTO_TEST_CASE(rejects_foreign_files)
+{
+	TempFile file;
+	{
+		blk::mapped_list<int> list(file.path);
+		list.push_back(1);
+	}
+	BOOST_CHECK_THROW(blk::mapped_list<Point>(file.path), std::runtime_error);
+	std::FILE* out = std::fopen(file.path.c_str(), "wb");
+	std::fputs("definitely not a list, but long enough to hold a header", out);
+	std::fclose(out);
+	BOOST_CHECK_THROW(blk::mapped_list<int>(file.path), std::runtime_error);
+	BOOST_CHECK_THROW(blk::mapped_list<int>("/nonexistent/dir/list.bin"), std::system_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,203 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <set>
+#include <vector>
+#include "../../include/pairing_heap.h"
+#include "../test_class.h"
+#include "../test_allocator.h"
+
+BOOST_AUTO_TEST_SUITE(pairing_heap)
+
+BOOST_AUTO_TEST_CASE(pops_in_priority_order)
+{
+	std::mt19937 rng(3);
+	blk::pairing_heap<int> heap;
+	std::priority_queue<int> reference;
+	BOOST_CHECK(heap.empty());
+	for (int step = 0; step < 20000; ++step)
+	{
+		if (reference.empty() || rng() % 3 != 0)
+		{
+			int value = static_cast<int>(rng() % 1000);
+			heap.push(value);
+			reference.push(value);
+		}
+		else
+		{
+			BOOST_REQUIRE(heap.top() == reference.top());
+			heap.pop();
+			reference.pop();
+		}
+		BOOST_REQUIRE(heap.size() == reference.size());
+	}
+	while (!reference.empty())
+	{
+		BOOST_REQUIRE(heap.top() == reference.top());
+		heap.pop();
+		reference.pop();
+	}
+	BOOST_CHECK(heap.empty());
+}
+
+BOOST_AUTO_TEST_CASE(decrease_key_and_erase_through_handles)
+{
+	std::mt19937 rng(11);
+	blk::pairing_heap<int, std::greater<int>> heap;
+	std::multiset<int> reference;
+	std::vector<blk::pairing_heap<int, std::greater<int>>::handle_type> handles;
+	for (int i = 0; i < 2000; ++i)
+	{
+		handles.push_back(heap.push(1000 + i));
+		reference.insert(1000 + i);
+	}
+	for (int step = 0; step < 3000; ++step)
+	{
+		size_t index = rng() % handles.size();
+		auto handle = handles[index];
+		reference.erase(reference.find(*handle));
+		if (step % 3 == 0)
+		{
+			heap.erase(handle);
+			handles[index] = handles.back();
+			handles.pop_back();
+		}
+		else
+		{
+			int value = *handle - static_cast<int>(rng() % 500);
+			heap.decrease_key(handle, value);
+			reference.insert(value);
+			BOOST_REQUIRE(*handle == value);
+		}
+		BOOST_REQUIRE(heap.top() == *reference.begin());
+	}
+	BOOST_CHECK(heap.size() == reference.size());
+	BOOST_CHECK_THROW(heap.decrease_key(handles.front(), *handles.front() + 1), std::invalid_argument);
+	for (int expected : reference)
+	{
+		BOOST_REQUIRE(heap.top() == expected);
+		heap.pop();
+	}
+}
+
+BOOST_AUTO_TEST_CASE(meld_keeps_handles)
+{
+	blk::pairing_heap<int> left;
+	blk::pairing_heap<int> right;
+	left.push(3);
+	left.push(8);
+	auto handle = right.push(1);
+	right.push(5);
+	left.meld(right);
+	BOOST_CHECK(right.empty() && left.size() == 4 && left.top() == 8);
+	left.decrease_key(handle, 9);
+	BOOST_CHECK(left.top() == 9);
+	left.meld(blk::pairing_heap<int>());
+	BOOST_CHECK(left.size() == 4);
+
+	std::vector<int> order;
+	for (; !left.empty(); left.pop())
+		order.push_back(left.top());
+	BOOST_CHECK((order == std::vector<int> { 9, 8, 5, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(copy_move_and_allocators)
+{
+	struct ValueLess
+	{
+		bool operator()(const TestClass& left, const TestClass& right) const { return left.getValue() < right.getValue(); }
+	};
+	ValueLess comp;
+	using heap_type = blk::pairing_heap<TestClass, ValueLess, TestAllocator<TestClass>>;
+	heap_type first(comp, TestAllocator<TestClass>(0));
+	for (int i = 0; i < 50; ++i)
+		first.emplace((i * 7) % 50);
+
+	heap_type copy(first);
+	BOOST_CHECK(copy.size() == 50 && copy.top().getValue() == 49);
+	heap_type moved(std::move(copy));
+	BOOST_CHECK(copy.empty() && moved.size() == 50);
+
+	// Unequal allocators move the values into new nodes
+	heap_type other(comp, TestAllocator<TestClass>(1));
+	other.emplace(100);
+	other.meld(moved);
+	BOOST_CHECK(moved.empty() && other.size() == 51 && other.top().getValue() == 100);
+	other.pop();
+	other = first;
+	BOOST_CHECK(other.size() == 50 && other.get_allocator().getValue() == 1);
+	other = std::move(first);
+	BOOST_CHECK(first.empty() && other.size() == 50);
+
+	std::swap(first, other);
+	for (int expected = 49; expected >= 0; --expected)
+	{
+		BOOST_REQUIRE(first.top().getValue() == expected);
+		first.pop();
+	}
+	BOOST_CHECK(first.empty() && other.empty());
+}
+
+BOOST_AUTO_TEST_CASE(dijkstra_shortest_paths)
+{
+	struct Entry
+	{
+		long distance;
+		int vertex;
+	};
+	struct Farther
+	{
+		bool operator()(const Entry& left, const Entry& right) const { return left.distance > right.distance; }
+	};
+	std::mt19937 rng(7);
+	const int vertices = 300;
+	std::vector<std::vector<std::pair<int, long>>> edges(vertices);
+	for (int i = 0; i < vertices * 6; ++i)
+		edges[rng() % vertices].emplace_back(static_cast<int>(rng() % vertices), static_cast<long>(rng() % 100));
+
+	const long infinity = std::numeric_limits<long>::max();
+	std::vector<long> expected(vertices, infinity);
+	std::priority_queue<std::pair<long, int>, std::vector<std::pair<long, int>>, std::greater<std::pair<long, int>>> queue;
+	expected[0] = 0;
+	queue.emplace(0, 0);
+	while (!queue.empty())
+	{
+		auto top = queue.top();
+		queue.pop();
+		if (top.first != expected[top.second])
+			continue;
+		for (auto& edge : edges[top.second])
+			if (top.first + edge.second < expected[edge.first])
+				queue.emplace(expected[edge.first] = top.first + edge.second, edge.first);
+	}
+
+	blk::pairing_heap<Entry, Farther> heap;
+	std::vector<blk::pairing_heap<Entry, Farther>::handle_type> handles(vertices);
+	std::vector<long> distances(vertices, infinity);
+	distances[0] = 0;
+	handles[0] = heap.push({ 0, 0 });
+	while (!heap.empty())
+	{
+		Entry top = heap.top();
+		heap.pop();
+		handles[top.vertex] = {};
+		for (auto& edge : edges[top.vertex])
+		{
+			long distance = top.distance + edge.second;
+			if (distance >= distances[edge.first])
+				continue;
+			distances[edge.first] = distance;
+			if (handles[edge.first] != blk::pairing_heap<Entry, Farther>::handle_type())
+				heap.decrease_key(handles[edge.first], { distance, edge.first });
+			else
+				handles[edge.first] = heap.push({ distance, edge.first });
+		}
+	}
+	BOOST_CHECK(distances == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
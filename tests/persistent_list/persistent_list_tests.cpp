@@ -0,0 +1,105 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+#include <vector>
+#include "../../include/persistent_list.h"
+#include "../test_class.h"
+
+BOOST_AUTO_TEST_SUITE(persistent_list)
+
+BOOST_AUTO_TEST_CASE(versions_are_independent)
+{
+	blk::persistent_list<int> v1 { 1, 2, 3 };
+	auto v2 = v1.push_front(0);
+	auto v3 = v1.pop_front();
+	auto v4 = v1.push_back(4);
+	BOOST_CHECK((std::vector<int>(v1.begin(), v1.end()) == std::vector<int> { 1, 2, 3 }));
+	BOOST_CHECK((std::vector<int>(v2.begin(), v2.end()) == std::vector<int> { 0, 1, 2, 3 }));
+	BOOST_CHECK((std::vector<int>(v3.begin(), v3.end()) == std::vector<int> { 2, 3 }));
+	BOOST_CHECK((std::vector<int>(v4.begin(), v4.end()) == std::vector<int> { 1, 2, 3, 4 }));
+	BOOST_CHECK(v2.size() == 4 && v3.size() == 2 && v4.size() == 4);
+	// Edits at the front share the rest of the nodes
+	BOOST_CHECK(&*std::next(v2.begin()) == &v1.front());
+	BOOST_CHECK(&v3.front() == &*std::next(v1.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(positional_edits_copy_the_prefix)
+{
+	blk::persistent_list<int> v1 { 1, 2, 3, 4 };
+	auto pos = std::next(v1.begin(), 2);
+	auto inserted = v1.insert(pos, 10);
+	auto erased = v1.erase(pos);
+	auto changed = v1.set(pos, 30);
+	BOOST_CHECK((std::vector<int>(inserted.begin(), inserted.end()) == std::vector<int> { 1, 2, 10, 3, 4 }));
+	BOOST_CHECK((std::vector<int>(erased.begin(), erased.end()) == std::vector<int> { 1, 2, 4 }));
+	BOOST_CHECK((std::vector<int>(changed.begin(), changed.end()) == std::vector<int> { 1, 2, 30, 4 }));
+	BOOST_CHECK(&*std::next(inserted.begin(), 3) == &*pos);
+	BOOST_CHECK(&*std::next(erased.begin(), 2) == &*std::next(pos));
+	BOOST_CHECK(v1 == blk::persistent_list<int>({ 1, 2, 3, 4 }));
+
+	blk::persistent_list<int> other { 7, 8 };
+	auto middle = v1.splice(pos, other);
+	auto back = v1.splice(v1.end(), other);
+	BOOST_CHECK((std::vector<int>(middle.begin(), middle.end()) == std::vector<int> { 1, 2, 7, 8, 3, 4 }));
+	BOOST_CHECK((std::vector<int>(back.begin(), back.end()) == std::vector<int> { 1, 2, 3, 4, 7, 8 }));
+	BOOST_CHECK(&*std::next(back.begin(), 4) == &other.front());
+	BOOST_CHECK(middle.size() == 6 && back.size() == 6);
+}
+
+BOOST_AUTO_TEST_CASE(transient_batches_edits)
+{
+	blk::persistent_list<TestClass> base;
+	base = base.emplace_front(2).emplace_front(1);
+	auto builder = base.transient();
+	builder.emplace_back(3);
+	builder.emplace_front(0);
+	builder.front() = TestClass(-1);
+	auto next = builder.persistent();
+	BOOST_CHECK(builder.empty());
+	BOOST_CHECK(base.size() == 2 && base.front().getValue() == 1);
+	std::vector<int> values;
+	for (auto& v : next)
+		values.push_back(v.getValue());
+	BOOST_CHECK((values == std::vector<int> { -1, 1, 2, 3 }));
+
+	blk::persistent_list<int> shared { 5, 6 };
+	auto edit = shared.transient();
+	edit.front() = 50;
+	edit.pop_front();
+	edit.back() = 60;
+	auto edited = edit.persistent();
+	BOOST_CHECK(edited.size() == 1 && edited.front() == 60);
+	BOOST_CHECK(shared.front() == 5 && *std::next(shared.begin()) == 6);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_readers)
+{
+	blk::persistent_list<int> version;
+	for (int i = 0; i < 1000; i++)
+		version = version.push_front(i);
+	std::vector<std::thread> readers;
+	std::vector<long long> sums(4, 0);
+	for (int t = 0; t < 4; t++)
+	{
+		readers.emplace_back([&sums, version, t]()
+		{
+			for (int round = 0; round < 20; round++)
+			{
+				auto snapshot = version.pop_front().push_front(round);
+				long long sum = 0;
+				for (int v : snapshot)
+					sum += v;
+				sums[t] += sum - round;
+			}
+		});
+	}
+	for (int i = 0; i < 100; i++)
+		version = version.pop_front();
+	for (auto& reader : readers)
+		reader.join();
+	for (long long sum : sums)
+		BOOST_CHECK(sum == 20LL * (998 * 999 / 2));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
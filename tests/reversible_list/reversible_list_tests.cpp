@@ -0,0 +1,58 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+#include "../../include/reversible_list.h"
+
+BOOST_AUTO_TEST_SUITE(reversible_list)
+
+BOOST_AUTO_TEST_CASE(reverse_flips_order)
+{
+	blk::reversible_list<int> list { 1, 2, 3, 4 };
+	list.reverse();
+	BOOST_CHECK(list.is_reversed());
+	BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int> { 4, 3, 2, 1 }));
+	BOOST_CHECK((std::vector<int>(list.rbegin(), list.rend()) == std::vector<int> { 1, 2, 3, 4 }));
+	BOOST_CHECK(list.front() == 4 && list.back() == 1);
+	list.reverse();
+	BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int> { 1, 2, 3, 4 }));
+}
+
+BOOST_AUTO_TEST_CASE(modifiers_follow_logical_order)
+{
+	blk::reversible_list<int> list { 1, 2, 3 };
+	list.reverse();
+	list.push_back(0);
+	list.push_front(4);
+	BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int> { 4, 3, 2, 1, 0 }));
+
+	auto it = list.insert(std::next(list.begin(), 2), 10);
+	BOOST_CHECK(*it == 10 && *std::next(it) == 2);
+	it = list.erase(it);
+	BOOST_CHECK(*it == 2);
+	it = list.erase(std::next(list.begin()), std::next(list.begin(), 3));
+	BOOST_CHECK(*it == 1);
+	BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int> { 4, 1, 0 }));
+	list.insert(list.end(), 9);
+	list.pop_front();
+	BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int> { 1, 0, 9 }));
+	list.pop_back();
+	BOOST_CHECK(list.size() == 2 && list.back() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(normalize_and_sort)
+{
+	blk::reversible_list<int> list { 5, 1, 4 };
+	list.reverse();
+	blk::reversible_list<int> copy(list);
+	BOOST_CHECK(!copy.is_reversed());
+	BOOST_CHECK(copy == list);
+	list.normalize();
+	BOOST_CHECK(!list.is_reversed());
+	BOOST_CHECK(copy == list);
+	list.reverse();
+	list.sort();
+	BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int> { 1, 4, 5 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
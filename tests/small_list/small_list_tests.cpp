@@ -0,0 +1,162 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../../include/small_list.h"
+#include "../test_class.h"
+#include "../test_allocator.h"
+
+BOOST_AUTO_TEST_SUITE(small_list)
+
+BOOST_AUTO_TEST_CASE(inline_elements_do_not_spill)
+{
+	blk::small_list<int, 4> list;
+	for (int i = 0; i < 4; i++)
+		list.push_back(i);
+	BOOST_CHECK(list.size() == 4);
+	BOOST_CHECK(list.spilled() == 0);
+	list.push_back(4);
+	list.push_back(5);
+	BOOST_CHECK(list.spilled() == 2);
+	int expected = 0;
+	for (auto i : list)
+		BOOST_CHECK(i == expected++);
+	BOOST_CHECK(expected == 6);
+}
+
+BOOST_AUTO_TEST_CASE(erased_slots_are_reused)
+{
+	blk::small_list<int, 2> list { 1, 2 };
+	list.pop_front();
+	list.push_back(3);
+	BOOST_CHECK(list.spilled() == 0);
+	BOOST_CHECK(*list.begin() == 2 && *list.rbegin() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(copy_and_move)
+{
+	blk::small_list<TestClass, 2> l1;
+	for (int i = 0; i < 5; i++)
+		l1.emplace_back(i);
+	blk::small_list<TestClass, 2> l2(l1);
+	blk::small_list<TestClass, 2> l3(std::move(l1));
+	BOOST_CHECK(l1.empty());
+	BOOST_CHECK(l2.size() == 5 && l3.size() == 5);
+	BOOST_CHECK(l2.spilled() == 3 && l3.spilled() == 3);
+	auto it2 = l2.begin();
+	auto it3 = l3.begin();
+	for (int i = 0; i < 5; i++, ++it2, ++it3)
+	{
+		BOOST_CHECK(it2->getValue() == i);
+		BOOST_CHECK(it3->getValue() == i);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(splice_moves_inline_elements)
+{
+	blk::small_list<int, 2> l1 { 1, 2, 3 };
+	blk::small_list<int, 2> l2 { 10, 20, 30 };
+	l1.splice(l1.end(), l2);
+	BOOST_CHECK(l2.empty());
+	BOOST_CHECK(l1.size() == 6);
+	BOOST_CHECK(l1.spilled() == 4);
+	int expected[] = { 1, 2, 3, 10, 20, 30 };
+	int i = 0;
+	for (auto val : l1)
+		BOOST_CHECK(val == expected[i++]);
+
+	l2.splice(l2.begin(), l1, l1.begin());
+	BOOST_CHECK(l1.size() == 5 && l2.size() == 1);
+	BOOST_CHECK(*l2.begin() == 1);
+
+	auto last = l1.begin();
+	++last;
+	++last;
+	l2.splice(l2.end(), l1, l1.begin(), last);
+	BOOST_CHECK(l1.size() == 3 && l2.size() == 3);
+	BOOST_CHECK(*l2.rbegin() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(swap_lists)
+{
+	blk::small_list<int, 3> l1 { 1, 2, 3, 4 };
+	blk::small_list<int, 3> l2 { 5 };
+	std::swap(l1, l2);
+	BOOST_CHECK(l1.size() == 1 && *l1.begin() == 5);
+	BOOST_CHECK(l2.size() == 4 && *l2.begin() == 1 && *l2.rbegin() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(small_list_with_allocator)
+{
+	blk::small_list<TestClass, 1, TestAllocator<TestClass>> list(TestAllocator<TestClass>(0));
+	list.emplace_back(1);
+	list.emplace_back(2);
+	BOOST_CHECK(list.spilled() == 1);
+	BOOST_CHECK(list.get_allocator().upstream().getValue() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(node_handles_between_list_and_small_list)
+{
+	blk::list<int> heap { 1, 2 };
+	blk::small_list<int, 1> small { 0 };
+	int* address = &*heap.begin();
+	small.insert(small.end(), heap.extract(heap.begin()));
+	BOOST_CHECK(small.size() == 2 && small.spilled() == 1);
+	BOOST_CHECK(&*(++small.begin()) == address);
+
+	auto inlineNode = small.extract_upstream(small.begin());
+	BOOST_CHECK(inlineNode.value() == 0);
+	auto heapNode = small.extract_upstream(small.begin());
+	BOOST_CHECK(&heapNode.value() == address);
+	BOOST_CHECK(small.empty());
+	heap.insert(heap.begin(), std::move(heapNode));
+	heap.insert(heap.begin(), std::move(inlineNode));
+	int expected = 0;
+	for (auto i : heap)
+		BOOST_CHECK(i == expected++);
+	BOOST_CHECK(expected == 3);
+
+	// extract moves inline elements into upstream nodes, which other adopts
+	blk::small_list<int, 1> other;
+	other.insert(other.end(), small.extract(small.insert(small.end(), 5)));
+	BOOST_CHECK(other.size() == 1 && *other.begin() == 5);
+	BOOST_CHECK(other.spilled() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(extracted_node_outlives_small_list)
+{
+	blk::small_list<TestClass, 2>::node_type inlineNode;
+	blk::small_list<TestClass, 2>::node_type heapNode;
+	{
+		blk::small_list<TestClass, 2> small;
+		for (int i = 0; i < 3; i++)
+			small.emplace_back(i);
+		inlineNode = small.extract(small.begin());
+		heapNode = small.extract(--small.end());
+		BOOST_CHECK(small.size() == 1);
+	}
+	BOOST_CHECK(inlineNode.value().getValue() == 0);
+	BOOST_CHECK(heapNode.value().getValue() == 2);
+
+	blk::list<TestClass> heap;
+	heap.insert(heap.end(), std::move(inlineNode));
+	BOOST_CHECK(heap.size() == 1 && heap.front().getValue() == 0);
+	// heapNode is released here, after the list it came from is gone
+}
+
+BOOST_AUTO_TEST_CASE(split_moves_inline_elements)
+{
+	blk::small_list<int, 4> list { 0, 1, 2, 3, 4, 5 };
+	auto tail = list.split(std::next(list.begin(), 2));
+	BOOST_CHECK(list.size() == 2 && list.back() == 1);
+	BOOST_CHECK(tail.size() == 4 && tail.front() == 2 && tail.back() == 5);
+	list.push_back(7);
+	BOOST_CHECK(list.size() == 3 && list.back() == 7);
+
+	auto parts = tail.split_into(3);
+	BOOST_CHECK(tail.empty());
+	BOOST_CHECK(parts.size() == 3 && parts[0].size() == 2 && parts[1].size() == 1 && parts[2].size() == 1);
+	BOOST_CHECK(parts[0].front() == 2 && parts[0].back() == 3 && parts[2].front() == 5);
+	BOOST_CHECK(parts[0].spilled() == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
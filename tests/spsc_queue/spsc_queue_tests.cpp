@@ -0,0 +1,96 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <vector>
+#include "../../include/spsc_queue.h"
+#include "../test_class.h"
+
+BOOST_AUTO_TEST_SUITE(spsc_queue)
+
+BOOST_AUTO_TEST_CASE(fill_and_drain)
+{
+	static_assert(blk::spsc_queue<int, 4>::capacity() == 4, "capacity must be usable at compile time");
+	blk::spsc_queue<TestClass, 4> queue;
+	BOOST_CHECK(queue.empty() && queue.front() == nullptr);
+	for (int i = 0; i < 4; ++i)
+		BOOST_CHECK(queue.try_emplace(i));
+	BOOST_CHECK(!queue.try_push(TestClass(4)));
+	BOOST_CHECK(queue.size() == 4 && queue.front()->getValue() == 0);
+
+	TestClass value(-1);
+	for (int i = 0; i < 4; ++i)
+	{
+		BOOST_REQUIRE(queue.try_pop(value));
+		BOOST_CHECK(value.getValue() == i);
+		BOOST_CHECK(queue.try_push(TestClass(i + 4)));
+	}
+	BOOST_CHECK(queue.size() == 4 && queue.front()->getValue() == 4);
+	// The remaining elements are destroyed with the queue
+}
+
+BOOST_AUTO_TEST_CASE(batched_push_and_pop)
+{
+	blk::spsc_queue<int, 8> queue;
+	std::vector<int> input { 0, 1, 2, 3, 4, 5 };
+	BOOST_CHECK(queue.try_push_n(input.begin(), input.size()) == 6);
+	BOOST_CHECK(queue.try_push_n(input.begin(), input.size()) == 2);
+	BOOST_CHECK(queue.try_push_n(input.begin(), 1) == 0);
+
+	std::vector<int> output(10, -1);
+	BOOST_CHECK(queue.try_pop_n(output.begin(), 3) == 3);
+	BOOST_CHECK(queue.try_pop_n(output.begin() + 3, 10) == 5);
+	BOOST_CHECK(queue.try_pop_n(output.begin(), 1) == 0 && queue.empty());
+	BOOST_CHECK((output == std::vector<int> { 0, 1, 2, 3, 4, 5, 0, 1, -1, -1 }));
+
+	// Wrapping around the end of the ring
+	BOOST_CHECK(queue.try_push_n(input.begin(), 6) == 6);
+	std::vector<int> wrapped;
+	BOOST_CHECK(queue.try_pop_n(std::back_inserter(wrapped), 8) == 6);
+	BOOST_CHECK(wrapped == input);
+}
+
+BOOST_AUTO_TEST_CASE(producer_and_consumer_threads)
+{
+	const int count = 200000;
+	blk::spsc_queue<int, 1024> queue;
+	std::thread producer([&]
+	{
+		int buffer[16];
+		for (int next = 0; next < count;)
+		{
+			if (next % 3 == 0)
+			{
+				if (queue.try_push(next))
+					++next;
+				else
+					std::this_thread::yield();
+				continue;
+			}
+			int batch = std::min(16, count - next);
+			for (int i = 0; i < batch; ++i)
+				buffer[i] = next + i;
+			size_t pushed = queue.try_push_n(buffer, batch);
+			if (pushed == 0)
+				std::this_thread::yield();
+			next += static_cast<int>(pushed);
+		}
+	});
+
+	bool ordered = true;
+	int buffer[32];
+	for (int expected = 0; expected < count;)
+	{
+		size_t popped = queue.try_pop_n(buffer, expected % 2 ? 1 : 32);
+		if (popped == 0)
+			std::this_thread::yield();
+		for (size_t i = 0; i < popped; ++i)
+			ordered = ordered && buffer[i] == expected++;
+	}
+	producer.join();
+	BOOST_CHECK(ordered && queue.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
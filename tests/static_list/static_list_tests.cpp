@@ -0,0 +1,99 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <type_traits>
+#include <utility>
+#include "../../include/static_list.h"
+#include "../test_class.h"
+
+namespace
+{
+	struct IdentityKey
+	{
+		int operator()(int v) const { return v; }
+	};
+
+	template<class List, class = void>
+	struct HasSortByKey : std::false_type {};
+	template<class List>
+	struct HasSortByKey<List, decltype(std::declval<List&>().sort_by_key(IdentityKey()))> : std::true_type {};
+	template<class List, class = void>
+	struct HasUniqueAll : std::false_type {};
+	template<class List>
+	struct HasUniqueAll<List, decltype(std::declval<List&>().unique_all())> : std::true_type {};
+	template<class List, class = void>
+	struct HasSplitInto : std::false_type {};
+	template<class List>
+	struct HasSplitInto<List, decltype((void)std::declval<List&>().split_into(2))> : std::true_type {};
+}
+
+BOOST_AUTO_TEST_SUITE(static_list)
+
+BOOST_AUTO_TEST_CASE(allocating_members_are_deleted)
+{
+	using list_type = blk::static_list<int, 8>;
+	static_assert(!HasSortByKey<list_type>::value, "sort_by_key allocates key records");
+	static_assert(!HasUniqueAll<list_type>::value, "unique_all allocates a hash set");
+	static_assert(!HasSplitInto<list_type>::value, "split_into allocates a vector");
+	static_assert(HasSortByKey<blk::list<int>>::value && HasUniqueAll<blk::list<int>>::value, "list keeps them");
+}
+
+BOOST_AUTO_TEST_CASE(capacity_is_constant_expression)
+{
+	static_assert(blk::static_list<int, 8>::capacity() == 8, "capacity must be usable at compile time");
+	static_assert(blk::static_list<int, 8>::max_size() == 8, "max_size must be usable at compile time");
+}
+
+BOOST_AUTO_TEST_CASE(fill_to_capacity)
+{
+	blk::static_list<int, 4> list;
+	for (int i = 0; i < 4; i++)
+		list.push_back(i);
+	BOOST_CHECK(list.full());
+	BOOST_CHECK(list.size() == 4);
+	BOOST_CHECK_THROW(list.push_back(4), std::length_error);
+	BOOST_CHECK(list.size() == 4);
+	BOOST_CHECK(*list.rbegin() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(try_modifiers_report_overflow)
+{
+	blk::static_list<TestClass, 2> list;
+	BOOST_CHECK(list.try_push_back(TestClass(1)));
+	BOOST_CHECK(list.try_push_front(TestClass(0)));
+	BOOST_CHECK(!list.try_push_back(TestClass(2)));
+	BOOST_CHECK(list.try_emplace(list.end(), 3) == list.end());
+	BOOST_CHECK(list.size() == 2);
+	BOOST_CHECK(list.begin()->getValue() == 0);
+
+	list.pop_front();
+	BOOST_CHECK(list.try_push_back(TestClass(2)));
+	BOOST_CHECK(list.rbegin()->getValue() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(splice_between_static_lists)
+{
+	blk::static_list<int, 4> l1 { 1, 2 };
+	blk::static_list<int, 4> l2 { 3, 4 };
+	l1.splice(l1.end(), l2);
+	BOOST_CHECK(l1.size() == 4 && l2.empty());
+	int expected = 1;
+	for (auto i : l1)
+		BOOST_CHECK(i == expected++);
+
+	blk::static_list<int, 4> l3 { 5 };
+	BOOST_CHECK_THROW(l1.splice(l1.end(), l3), std::length_error);
+}
+
+BOOST_AUTO_TEST_CASE(copy_and_move)
+{
+	blk::static_list<int, 3> l1 { 1, 2, 3 };
+	blk::static_list<int, 3> l2(l1);
+	blk::static_list<int, 3> l3(std::move(l1));
+	BOOST_CHECK(l1.empty());
+	BOOST_CHECK(l2 == l3);
+	l1 = l2;
+	BOOST_CHECK(l1.size() == 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
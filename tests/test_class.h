@@ -21,8 +21,10 @@ public:
 		if (this == &other)
 			return *this;
 
+		delete m_ptr;
 		m_ptr = other.m_ptr;
 		other.m_ptr = nullptr;
+		return *this;
 	}
 
 	TestClass& operator=(const TestClass& other)
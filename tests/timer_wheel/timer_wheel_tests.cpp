@@ -0,0 +1,149 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include "../../include/timer_wheel.h"
+
+namespace
+{
+template<class List>
+std::vector<int> payloads(const List& list)
+{
+	std::vector<int> res;
+	for (const auto& entry : list)
+		res.push_back(entry.payload);
+	return res;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(timer_wheel)
+
+BOOST_AUTO_TEST_CASE(fires_on_deadline)
+{
+	blk::timer_wheel<int> wheel;
+	wheel.schedule(3, 3);
+	wheel.schedule(1, 1);
+	wheel.schedule(0, 0);
+	wheel.schedule(300, 300);
+	wheel.schedule(70000, 70000);
+	BOOST_CHECK(wheel.size() == 5);
+
+	blk::timer_wheel<int>::list_type expired;
+	BOOST_CHECK(wheel.advance(1, expired) == 2);
+	BOOST_CHECK((payloads(expired) == std::vector<int> { 1, 0 }));
+	expired.clear();
+	BOOST_CHECK(wheel.advance(1, expired) == 0);
+	BOOST_CHECK(wheel.advance(297, expired) == 1 && expired.front().deadline() == 3);
+	expired.clear();
+	BOOST_CHECK(wheel.advance(1, expired) == 1 && expired.front().payload == 300 && wheel.now() == 300);
+	expired.clear();
+	BOOST_CHECK(wheel.advance(69699, expired) == 0);
+	BOOST_CHECK(wheel.advance(1, expired) == 1 && expired.front().payload == 70000);
+	BOOST_CHECK(wheel.empty() && wheel.now() == 70000);
+}
+
+BOOST_AUTO_TEST_CASE(cancel_and_reschedule)
+{
+	blk::timer_wheel<std::string> wheel(1000);
+	auto a = wheel.schedule(10, "a");
+	auto b = wheel.emplace(500, 2, 'b');
+	auto c = wheel.schedule(100000, "c");
+	wheel.cancel(a);
+	wheel.reschedule(c, 5);
+	wheel.reschedule(b, 1u << 20);
+	BOOST_CHECK(wheel.size() == 2);
+	BOOST_CHECK(c->deadline() == 1005 && b->payload == "bb");
+
+	blk::timer_wheel<std::string>::list_type expired;
+	BOOST_CHECK(wheel.advance(600, expired) == 1 && expired.front().payload == "c");
+	expired.clear();
+	BOOST_CHECK(wheel.advance(1u << 20, expired) == 1 && expired.front().payload == "bb");
+	BOOST_CHECK(expired.front().deadline() == 1000 + (1u << 20));
+	wheel.schedule(7, "d");
+	wheel.clear();
+	BOOST_CHECK(wheel.empty() && wheel.advance(10, expired) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(far_deadlines_and_skipping)
+{
+	const std::uint64_t far = (std::uint64_t(1) << 34) + 12345;
+	blk::timer_wheel<int> wheel(77);
+	wheel.schedule(far, 1);
+	wheel.schedule(far - 1, 2);
+	blk::timer_wheel<int>::list_type expired;
+	BOOST_CHECK(wheel.advance(far - 2, expired) == 0);
+	BOOST_CHECK(wheel.advance(1, expired) == 1 && expired.back().payload == 2);
+	BOOST_CHECK(wheel.advance(1, expired) == 1 && expired.back().payload == 1);
+	BOOST_CHECK(expired.back().deadline() == 77 + far && wheel.now() == 77 + far);
+}
+
+BOOST_AUTO_TEST_CASE(matches_a_sorted_reference_under_churn)
+{
+	std::mt19937 rng(11);
+	std::uniform_int_distribution<std::uint64_t> delays(0, 200000);
+	blk::timer_wheel<int> wheel;
+	std::vector<blk::timer_wheel<int>::handle> handles;
+	std::vector<bool> live;
+	std::multimap<std::uint64_t, int> reference;
+	blk::timer_wheel<int>::list_type expired;
+	for (int round = 0; round < 200; ++round)
+	{
+		for (int i = 0; i < 50; ++i)
+		{
+			int id = static_cast<int>(handles.size());
+			std::uint64_t delay = delays(rng);
+			handles.push_back(wheel.schedule(delay, id));
+			live.push_back(true);
+			reference.emplace(handles.back()->deadline(), id);
+		}
+		for (int i = 0; i < 10; ++i)
+		{
+			int id = static_cast<int>(rng() % handles.size());
+			if (!live[id])
+				continue;
+			auto range = reference.equal_range(handles[id]->deadline());
+			for (auto it = range.first; it != range.second; ++it)
+				if (it->second == id)
+				{
+					reference.erase(it);
+					break;
+				}
+			if (i % 2 == 0)
+			{
+				wheel.cancel(handles[id]);
+				live[id] = false;
+			}
+			else
+			{
+				wheel.reschedule(handles[id], delays(rng));
+				reference.emplace(handles[id]->deadline(), id);
+			}
+		}
+		wheel.advance(rng() % 3000, expired);
+		for (const auto& entry : expired)
+		{
+			BOOST_REQUIRE(!reference.empty());
+			BOOST_REQUIRE(entry.deadline() == reference.begin()->first);
+			BOOST_REQUIRE(entry.deadline() <= wheel.now());
+			auto range = reference.equal_range(entry.deadline());
+			bool found = false;
+			for (auto it = range.first; it != range.second; ++it)
+				if (it->second == entry.payload)
+				{
+					reference.erase(it);
+					found = true;
+					break;
+				}
+			BOOST_REQUIRE(found);
+			live[entry.payload] = false;
+		}
+		expired.clear();
+		BOOST_REQUIRE(reference.empty() || reference.begin()->first > wheel.now());
+		BOOST_REQUIRE(wheel.size() == reference.size());
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()